@@ -0,0 +1,38 @@
+// 配列を走査するループ。int配列とchar配列の読み書き
+int a[4096];
+char s[4096];
+
+int sum(int *p, int n) {
+  int i;
+  int t;
+  t = 0;
+  for (i = 0; i < n; i = i + 1) t = t + p[i];
+  return t;
+}
+
+int count(char *p, int n, int c) {
+  int i;
+  int t;
+  t = 0;
+  for (i = 0; i < n; i = i + 1)
+    if (p[i] == c) t = t + 1;
+  return t;
+}
+
+int main() {
+  int i;
+  int r;
+  int t;
+  for (i = 0; i < 4096; i = i + 1) {
+    a[i] = i;
+    s[i] = i - i / 7 * 7;
+  }
+
+  t = 0;
+  for (r = 0; r < 2000; r = r + 1) {
+    t = t + sum(a, 4096) - 8386560;
+    t = t + count(s, 4096, 3) - 585;
+  }
+  printf("array: %d\n", t);
+  return t != 0;
+}
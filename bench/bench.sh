@@ -0,0 +1,78 @@
+#!/bin/sh
+#
+# 注釈：
+# コンパイラの処理速度と、生成したコードの実行速度を計測する (make bench)。
+# 使い方: bench/bench.sh [scale]
+#   コンパイル: bench/gen.shで生成した入力を-O0と-O1でコンパイルし、
+#              トークン/秒、ノード/秒、アセンブリのバイト/秒と
+#              各フェーズ終了時点の最大RSSを表示する
+#   実行:      bench/*.cをコンパイル・リンクして実行時間を表示する
+# 環境変数 CC9 で計測する9ccを、BENCH_RUNS で実行の繰り返し回数を変えられる。
+#
+
+set -eu
+
+cc9=${CC9:-./build/9cc}
+scale=${1:-1}
+runs=${BENCH_RUNS:-3}
+dir=./build/bench
+
+mkdir -p $dir
+
+now_ms() {
+  echo $(($(date +%s%N) / 1000000))
+}
+
+echo "compile (scale=$scale)"
+printf "%-8s %-4s %10s %12s %12s %12s %9s %9s %9s\n" input opt "wall(ms)" \
+  "tokens/s" "nodes/s" "asm B/s" "rss.tok" "rss.parse" "rss.cg"
+
+for kind in funcs expr globals loops; do
+  src=$dir/$kind.c
+  bench/gen.sh $kind $scale >$src
+
+  for opt in -O0 -O1; do
+    asm=$dir/$kind$opt.s
+    $cc9 $opt --stats -o $asm $src 2>$dir/$kind$opt.stats
+    bytes=$(wc -c <$asm)
+
+    # --statsの出力から、各フェーズの時間(ms)と最大RSS、個数を取り出す
+    awk -v kind=$kind -v opt=$opt -v bytes=$bytes '
+      function rate(n, ms) { return ms > 0 ? n / (ms / 1000) : 0 }
+      $1 == "tokenize" { tok_ms = $2; tok_rss = $4 }
+      $1 == "parse" { parse_ms = $2; parse_rss = $4 }
+      $1 == "codegen" { cg_ms = $2; cg_rss = $4 }
+      $1 == "total" && !total { total = $2 }
+      $1 == "tokens" { tokens = $2 }
+      $1 == "nodes" { nodes = $2 }
+      END {
+        printf "%-8s %-4s %10.1f %12.0f %12.0f %12.0f %9d %9d %9d\n", kind, opt,
+          total, rate(tokens, tok_ms), rate(nodes, parse_ms),
+          rate(bytes, cg_ms), tok_rss, parse_rss, cg_rss
+      }' $dir/$kind$opt.stats
+  done
+done
+
+echo
+echo "runtime (best of $runs)"
+printf "%-8s %-4s %10s\n" program opt "wall(ms)"
+
+for src in bench/*.c; do
+  name=$(basename $src .c)
+  for opt in -O0 -O1; do
+    exe=$dir/$name$opt
+    $cc9 $opt -c -o $exe.o $src
+    gcc -static -o $exe $exe.o
+
+    best=
+    i=0
+    while [ $i -lt $runs ]; do
+      start=$(now_ms)
+      $exe >/dev/null
+      ms=$(($(now_ms) - start))
+      if [ -z "$best" ] || [ $ms -lt $best ]; then best=$ms; fi
+      i=$((i + 1))
+    done
+    printf "%-8s %-4s %10d\n" $name $opt $best
+  done
+done
@@ -0,0 +1,12 @@
+// 関数呼び出しの多い再帰 (test/testsのfibと同じ)
+int fib(int x) {
+  if (x <= 1) return 1;
+  return fib(x - 1) + fib(x - 2);
+}
+
+int main() {
+  int n;
+  n = fib(32);
+  printf("fib(32) = %d\n", n);
+  return n != 3524578;
+}
@@ -0,0 +1,99 @@
+#!/bin/sh
+#
+# 注釈：
+# ベンチマーク用の大きな入力を生成して標準出力に書き出す。
+# 使い方: bench/gen.sh <kind> [scale]
+#   funcs:   数千個の小さな関数
+#   expr:    深くネストした式と長い式
+#   globals: 大きなグローバル配列と長い文字列リテラル
+#   loops:   本体が長いfor文とwhile文
+# scaleを大きくすると、それに比例して入力が大きくなる。
+#
+
+set -eu
+
+kind=${1:?usage: gen.sh <funcs|expr|globals|loops> [scale]}
+scale=${2:-1}
+
+case $kind in
+  funcs)
+    # 関数が前の関数を呼び出す鎖。mainから全体をたどる
+    awk -v n=$((scale * 5000)) 'BEGIN {
+      print "int f0(int x) { return x + 1; }"
+      for (i = 1; i < n; i++) {
+        printf "int f%d(int x) {\n", i
+        print "  int a;"
+        print "  int b;"
+        printf "  a = x * %d + %d;\n", i % 7 + 1, i
+        printf "  b = f%d(a - a / 1000 * 1000) - x;\n", i - 1
+        print "  if (b < 0) b = 0 - b;"
+        print "  while (b > 1000) b = b - 1000;"
+        print "  return b;"
+        print "}"
+      }
+      printf "int main() { return f%d(3) / 256; }\n", n - 1
+    }'
+    ;;
+  expr)
+    # 括弧で右にネストする式と、左結合で長く続く式
+    awk -v n=$((scale * 300)) 'BEGIN {
+      print "int deep(int x) {"
+      printf "  return "
+      for (i = 0; i < n; i++) printf "(x + %d * ", i % 9 + 1
+      printf "x"
+      for (i = 0; i < n; i++) printf ")"
+      print ";"
+      print "}"
+      print "int wide(int x) {"
+      printf "  return x"
+      for (i = 0; i < n * 20; i++) printf " %s x * %d", (i % 2 ? "-" : "+"), i % 5
+      print ";"
+      print "}"
+      print "int main() { return (deep(1) + wide(1)) / 1000000 == 123; }"
+    }'
+    ;;
+  globals)
+    # 大きな配列と、1KB近い文字列リテラル(9ccの上限は1024バイト)
+    awk -v n=$((scale * 500)) 'BEGIN {
+      for (j = 0; j < 15; j++)
+        line = line "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ\\n"
+      for (i = 0; i < n; i++) printf "int garr%d[%d];\n", i, 1000 + i
+      print "int main() {"
+      print "  char *p;"
+      for (i = 0; i < n; i++) {
+        printf "  p = \"%d:%s\";\n", i, line
+        printf "  garr%d[%d] = p[%d];\n", i, i, i % 64
+      }
+      print "  return garr0[0] - 48;"
+      print "}"
+    }'
+    ;;
+  loops)
+    # 本体に多数の文を持つループ
+    awk -v n=$((scale * 2000)) 'BEGIN {
+      print "int main() {"
+      print "  int a[16];"
+      print "  int i;"
+      print "  int j;"
+      print "  int s;"
+      print "  s = 0;"
+      print "  for (i = 0; i < 16; i = i + 1) a[i] = i;"
+      print "  for (i = 0; i < 10; i = i + 1) {"
+      for (k = 0; k < n; k++)
+        printf "    s = s + a[%d] * %d - i;\n", k % 16, k % 11
+      print "  }"
+      print "  j = 0;"
+      print "  while (j < 10) {"
+      for (k = 0; k < n; k++)
+        printf "    if (s > %d) s = s - a[%d]; else s = s + j;\n", k * 3, k % 16
+      print "    j = j + 1;"
+      print "  }"
+      print "  return s == 0;"
+      print "}"
+    }'
+    ;;
+  *)
+    echo "gen.sh: unknown kind: $kind" >&2
+    exit 1
+    ;;
+esac
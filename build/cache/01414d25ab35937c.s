@@ -0,0 +1,24 @@
+.global is_even
+is_even:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  mov r10, rax
+  cmp r10, 0
+  jne .L.end.is_even.1
+  mov rax, 1
+  jmp .L.return.is_even
+.L.end.is_even.1:
+  mov r10, [rbp-8]
+  sub r10, 1
+  mov rdi, r10
+  mov rsp, rbp
+  pop rbp
+  mov rax, 0
+  jmp is_odd
+.L.return.is_even:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,23 @@
+.global pick
+pick:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rdi
+  lea r10, [rbp-8]
+  mov r11, [rbp-8]
+  add r11, 1
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  jmp .L.cond.pick.1
+.L.begin.pick.1:
+  mov r10, [rbp-8]
+  mov rax, r10
+  jmp .L.return.pick
+.L.cond.pick.1:
+  jmp .L.begin.pick.1
+.L.return.pick:
+  mov rsp, rbp
+  pop rbp
+  ret
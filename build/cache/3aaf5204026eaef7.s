@@ -0,0 +1,30 @@
+.global via_ptr
+via_ptr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-32], rdi
+  lea r10, [rbp-24]
+  mov r11, [rbp-32]
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  lea r10, [rbp-16]
+  lea r11, [rbp-24]
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  lea r10, [rbp-8]
+  mov rax, r10
+  mov rdi, 1
+  mov [rax], rdi
+  mov r10, [rbp-16]
+  mov r10, [r10]
+  mov r11, [rbp-8]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.via_ptr
+.L.return.via_ptr:
+  mov rsp, rbp
+  pop rbp
+  ret
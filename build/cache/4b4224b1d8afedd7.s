@@ -0,0 +1,59 @@
+.global rot5
+rot5:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-56], rbx
+  mov [rbp-64], r12
+  mov [rbp-72], r13
+  mov [rbp-80], r14
+.L.tail.rot5:
+  mov [rbp-48], rdi
+  mov [rbp-40], rsi
+  mov [rbp-32], rdx
+  mov [rbp-24], rcx
+  mov [rbp-16], r8
+  mov [rbp-8], r9
+  mov rax, [rbp-48]
+  mov r10, rax
+  cmp r10, 0
+  jne .L.end.rot5.1
+  mov r10, [rbp-40]
+  imul r10, 10000
+  mov r11, [rbp-32]
+  imul r11, 1000
+  add r10, r11
+  mov r11, [rbp-24]
+  imul r11, 100
+  add r10, r11
+  mov r11, [rbp-16]
+  imul r11, 10
+  add r10, r11
+  mov r11, [rbp-8]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.rot5
+.L.end.rot5.1:
+  mov r10, [rbp-48]
+  sub r10, 1
+  mov r11, [rbp-32]
+  mov rbx, [rbp-24]
+  mov r12, [rbp-16]
+  mov r13, [rbp-8]
+  mov rax, [rbp-40]
+  mov r14, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rcx, r12
+  mov r8, r13
+  mov r9, r14
+  jmp .L.tail.rot5
+.L.return.rot5:
+  mov rbx, [rbp-56]
+  mov r12, [rbp-64]
+  mov r13, [rbp-72]
+  mov r14, [rbp-80]
+  mov rsp, rbp
+  pop rbp
+  ret
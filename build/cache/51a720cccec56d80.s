@@ -0,0 +1,21 @@
+.global both_return
+both_return:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  mov r10, rax
+  cmp r10, 0
+  je .L.else.both_return.1
+  mov rax, 1
+  jmp .L.return.both_return
+  jmp .L.end.both_return.1
+.L.else.both_return.1:
+  mov rax, 2
+  jmp .L.return.both_return
+.L.end.both_return.1:
+.L.return.both_return:
+  mov rsp, rbp
+  pop rbp
+  ret
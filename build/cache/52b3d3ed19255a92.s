@@ -0,0 +1,16 @@
+.global add2
+add2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov r10, [rbp-16]
+  mov r11, [rbp-8]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.add2
+.L.return.add2:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,34 @@
+.global count_up
+count_up:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  lea r10, [rbp-8]
+  mov r11, 0
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  jmp .L.cond.count_up.1
+.L.begin.count_up.1:
+  lea r10, [rbp-8]
+  mov r11, [rbp-8]
+  add r11, 1
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  mov r10, [rbp-8]
+  mov rax, [rbp-16]
+  mov r11, rax
+  cmp r10, r11
+  jne .L.end.count_up.2
+  mov r10, [rbp-8]
+  mov rax, r10
+  jmp .L.return.count_up
+.L.end.count_up.2:
+.L.cond.count_up.1:
+  jmp .L.begin.count_up.1
+.L.return.count_up:
+  mov rsp, rbp
+  pop rbp
+  ret
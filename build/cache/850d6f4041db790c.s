@@ -0,0 +1,48 @@
+.global assert
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-32], rbx
+  mov [rbp-40], r12
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  mov [rbp-8], rdx
+  mov r10, [rbp-24]
+  mov rax, [rbp-16]
+  mov r11, rax
+  cmp r10, r11
+  jne .L.else.assert.1
+  mov r10, offset .L.data.0
+  mov r11, [rbp-8]
+  mov rbx, [rbp-16]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call printf
+  mov r10, rax
+  jmp .L.end.assert.1
+.L.else.assert.1:
+  mov r10, offset .L.data.1
+  mov r11, [rbp-8]
+  mov rbx, [rbp-24]
+  mov r12, [rbp-16]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rcx, r12
+  mov rax, 0
+  call printf
+  mov r10, rax
+  mov rdi, 1
+  mov rax, 0
+  call exit
+  mov r10, rax
+.L.end.assert.1:
+.L.return.assert:
+  mov rbx, [rbp-32]
+  mov r12, [rbp-40]
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,35 @@
+.global count_const
+count_const:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  lea r10, [rbp-8]
+  mov r11, 0
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  jmp .L.cond.count_const.1
+.L.begin.count_const.1:
+  lea r10, [rbp-8]
+  mov r11, [rbp-8]
+  add r11, 1
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  mov r10, [rbp-8]
+  mov rax, [rbp-16]
+  mov r11, rax
+  cmp r10, r11
+  jne .L.end.count_const.2
+  mov r10, [rbp-8]
+  shl r10, 1
+  mov rax, r10
+  jmp .L.return.count_const
+.L.end.count_const.2:
+.L.cond.count_const.1:
+  jmp .L.begin.count_const.1
+.L.return.count_const:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,35 @@
+.global fib
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rbx
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  mov r10, rax
+  cmp r10, 1
+  jg .L.end.fib.1
+  mov rax, 1
+  jmp .L.return.fib
+.L.end.fib.1:
+  mov r10, [rbp-8]
+  sub r10, 1
+  mov rdi, r10
+  mov rax, 0
+  call fib
+  mov rbx, rax
+  mov r10, [rbp-8]
+  sub r10, 2
+  mov rdi, r10
+  mov rax, 0
+  call fib
+  mov r10, rax
+  mov rax, rbx
+  add rax, r10
+  mov r10, rax
+  jmp .L.return.fib
+.L.return.fib:
+  mov rbx, [rbp-16]
+  mov rsp, rbp
+  pop rbp
+  ret
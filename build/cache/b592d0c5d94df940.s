@@ -0,0 +1,33 @@
+.global clamp_add
+clamp_add:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-32], rbx
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  lea r10, [rbp-8]
+  mov r11, [rbp-24]
+  mov rbx, [rbp-16]
+  add r11, rbx
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  mov r10, rax
+  cmp r10, 0
+  jge .L.end.clamp_add.1
+  lea r10, [rbp-8]
+  mov r11, 0
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+.L.end.clamp_add.1:
+  mov r10, [rbp-8]
+  mov rax, r10
+  jmp .L.return.clamp_add
+.L.return.clamp_add:
+  mov rbx, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
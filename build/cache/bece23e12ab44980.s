@@ -0,0 +1,28 @@
+.global add6
+add6:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-48], rdi
+  mov [rbp-40], rsi
+  mov [rbp-32], rdx
+  mov [rbp-24], rcx
+  mov [rbp-16], r8
+  mov [rbp-8], r9
+  mov r10, [rbp-48]
+  mov r11, [rbp-40]
+  add r10, r11
+  mov r11, [rbp-32]
+  add r10, r11
+  mov r11, [rbp-24]
+  add r10, r11
+  mov r11, [rbp-16]
+  add r10, r11
+  mov r11, [rbp-8]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.add6
+.L.return.add6:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,32 @@
+.global sum_to
+sum_to:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-24], rbx
+.L.tail.sum_to:
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov rax, [rbp-16]
+  mov r10, rax
+  cmp r10, 0
+  jne .L.end.sum_to.1
+  mov r10, [rbp-8]
+  mov rax, r10
+  jmp .L.return.sum_to
+.L.end.sum_to.1:
+  mov r10, [rbp-16]
+  sub r10, 1
+  mov r11, [rbp-8]
+  mov rbx, [rbp-16]
+  mov rax, r11
+  add rax, rbx
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  jmp .L.tail.sum_to
+.L.return.sum_to:
+  mov rbx, [rbp-24]
+  mov rsp, rbp
+  pop rbp
+  ret
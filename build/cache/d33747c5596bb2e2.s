@@ -0,0 +1,17 @@
+.global addx
+addx:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov r10, [rbp-16]
+  mov r10, [r10]
+  mov r11, [rbp-8]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.addx
+.L.return.addx:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,22 @@
+.global sub_char
+sub_char:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-3], dil
+  mov [rbp-2], sil
+  mov [rbp-1], dl
+  movsx rax, byte ptr [rbp-3]
+  mov r10, rax
+  movsx rax, byte ptr [rbp-2]
+  mov r11, rax
+  sub r10, r11
+  movsx rax, byte ptr [rbp-1]
+  mov r11, rax
+  sub r10, r11
+  mov rax, r10
+  jmp .L.return.sub_char
+.L.return.sub_char:
+  mov rsp, rbp
+  pop rbp
+  ret
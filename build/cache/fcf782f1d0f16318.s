@@ -0,0 +1,11 @@
+.global ret3
+ret3:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+  mov rax, 3
+  jmp .L.return.ret3
+.L.return.ret3:
+  mov rsp, rbp
+  pop rbp
+  ret
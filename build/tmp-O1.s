@@ -0,0 +1,4726 @@
+.intel_syntax noprefix
+.data
+.L.data.211:
+  .string "OK\012"
+.L.data.210:
+  .string "for (i=7; 0; i=i+1) i=9; i;"
+.L.data.209:
+  .string "if (1) x=3; else x=4; x;"
+.L.data.208:
+  .string "char *p; char *q; p=0; q=p+3000000000; q-p==3000000000;"
+.L.data.207:
+  .string "int x[2][3]; x[1][2]=9; int *p; p=&*x[1]; p[2];"
+.L.data.206:
+  .string "g2[0]=7; int *p; p=&*g2; *p;"
+.L.data.205:
+  .string "int a[3]; a[0]=5; a[1]=6; int *p; p=&*a; *p+p[1];"
+.L.data.204:
+  .string "both_return(0)"
+.L.data.203:
+  .string "both_return(4)"
+.L.data.202:
+  .string "count_const(3)"
+.L.data.201:
+  .string "count_up(5)"
+.L.data.200:
+  .string "pick(5)"
+.L.data.199:
+  .string "via_ptr(3)"
+.L.data.198:
+  .string "is_odd(10001)"
+.L.data.197:
+  .string "is_even(10000)"
+.L.data.196:
+  .string "rot5(7, 1, 2, 3, 4, 5)"
+.L.data.195:
+  .string "sum_to(10000, 0)"
+.L.data.194:
+  .string "for (i=0; i<4; i=i+1) g2[i]=g2[i]-x[i]; g2[3]+g2[2]+i+x[3]+x[3]+x[2];"
+.L.data.193:
+  .string "p=x; s=0; for (i=0; i<10; i=i+1) s=p[i]+s; s;"
+.L.data.192:
+  .string "s=10; for (i=2; i<n; i=i+1) s=s+x[i]; s;"
+.L.data.191:
+  .string "char a[37]; char b[37]; for (i=1; i<37; i=i+1) b[i]=a[i]+a[i]; b[36]+b[0];"
+.L.data.190:
+  .string "for (i=0; i<11; i=i+1) z[i]=y[i]-x[i]+y[i]; z[10]+z[3]-x[2]+i-2;"
+.L.data.189:
+  .string "p=&i; for (i=0; i<3; i=i+1) x[i]=*p*3; x[2]+i;"
+.L.data.188:
+  .string "int i; char c[4]; for (i=0; i<4; i=i+1) c[i]=i; c[1]+c[2]+c[3];"
+.L.data.187:
+  .string "int i; for (i=0; i<4; i=i+1) g2[i]=i+1; g2[0]+g2[3];"
+.L.data.186:
+  .string "for (i=0; i<10; i=i+1) { if (i==3) i=7; s=s+i; } s;"
+.L.data.185:
+  .string "int i; int x[5]; i=0; while (i<5) { x[i]=i*i; i=i+1; } x[4]+x[3]+i;"
+.L.data.184:
+  .string "for (i=0; i<3; i=i+1) for (j=0; j<4; j=j+1) s=s+i*j; s;"
+.L.data.183:
+  .string "int i; int s; s=0; for (i=0; i<10; i=i+1) s=s+i; i+s;"
+.L.data.182:
+  .string "int a; { int b=1; a=b; } { int c=2; a=a+c; } a;"
+.L.data.181:
+  .string "struct {char a; int b;} x; x.a=2; x.b=5; x.a+x.b;"
+.L.data.180:
+  .string "struct {char a; char b; int c;} x; sizeof(x);"
+.L.data.179:
+  .string "struct {int a; char b;} x; sizeof(x);"
+.L.data.178:
+  .string "struct {char a; int b;} x; sizeof(x);"
+.L.data.177:
+  .string "struct {char a; char b;} x; sizeof(x);"
+.L.data.176:
+  .string "struct {int a[3];} x[2]; sizeof(x)};"
+.L.data.175:
+  .string "struct {int a;} x[4]; sizeof(x);"
+.L.data.174:
+  .string "struct {int a[3];} x; sizeof(x);"
+.L.data.173:
+  .string "struct {int a; int b;} x; sizeof(x);"
+.L.data.172:
+  .string "struct {int a;} x; sizeof(x);"
+.L.data.171:
+  .string "struct { struct { int b; } a; } x; x.a.b=6; x.a.b;"
+.L.data.170:
+  .string "struct {int a[3]; int b[5];} x; int *p=&x; x.b[0]=7; p[3];"
+.L.data.169:
+  .string "struct {int a[3]; int b[5];} x; int *p=&x; x.a[0]=6; p[0];"
+.L.data.168:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[3]=3; x[1].b;"
+.L.data.167:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[2]=2; x[1].a;"
+.L.data.166:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[1]=1; x[0].b;"
+.L.data.165:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[0]=0; x[0].a;"
+.L.data.164:
+  .string "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.c;"
+.L.data.163:
+  .string "struct {char a; int b; char c;} a; x.b=x; x.a=2; x.b=3; x.b;"
+.L.data.162:
+  .string "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.a;"
+.L.data.161:
+  .string "struct {int a; int b;} x; x.a=1; x.b=2; x.b;"
+.L.data.160:
+  .string "struct {int a; int b;} x; x.a=1; x.b=2; x.a;"
+.L.data.159:
+  .string "int x[5]; int *y=x+2; y-x;"
+.L.data.158:
+  .string "int x=2; { x=3; } x;"
+.L.data.157:
+  .string "int x=2; { int x=3; } int y=4; x;"
+.L.data.156:
+  .string "int x=2; { int x=3; } x;"
+.L.data.155:
+  .string "\"\\l\"[0]"
+.L.data.154:
+  .string "l"
+.L.data.153:
+  .string "\"\\k\"[0]"
+.L.data.152:
+  .string "k"
+.L.data.151:
+  .string "\"\\j\"[0]"
+.L.data.150:
+  .string "j"
+.L.data.149:
+  .string "\"\\0\"[0]"
+.L.data.148:
+  .string "\000"
+.L.data.147:
+  .string "\"\\e\"[0]"
+.L.data.146:
+  .string "\033"
+.L.data.145:
+  .string "\"\\r\"[0]"
+.L.data.144:
+  .string "\015"
+.L.data.143:
+  .string "\"\\f\"[0]"
+.L.data.142:
+  .string "\014"
+.L.data.141:
+  .string "\"\\v\"[0]"
+.L.data.140:
+  .string "\013"
+.L.data.139:
+  .string "\"\\n\"[0]"
+.L.data.138:
+  .string "\012"
+.L.data.137:
+  .string "\"\\t\"[0]"
+.L.data.136:
+  .string "\011"
+.L.data.135:
+  .string "\"\\b\"[0]"
+.L.data.134:
+  .string "\010"
+.L.data.133:
+  .string "\"\\a\"[0]"
+.L.data.132:
+  .string "\007"
+.L.data.131:
+  .string "sizeof(\"abc\")"
+.L.data.129:
+  .string "\"abc\"[3]"
+.L.data.128:
+  .string "abc"
+.L.data.127:
+  .string "\"abc\"[2]"
+.L.data.126:
+  .string "abc"
+.L.data.125:
+  .string "\"abc\"[1]"
+.L.data.124:
+  .string "abc"
+.L.data.123:
+  .string "\"abc\"[0]"
+.L.data.122:
+  .string "abc"
+.L.data.121:
+  .string "sub_char(7, 3, 3)"
+.L.data.120:
+  .string "char x[10]; sizeof(x);"
+.L.data.119:
+  .string "char x; sizeof(x);"
+.L.data.118:
+  .string "char x=1; char y=2; y;"
+.L.data.117:
+  .string "char x=1; char y=2; x;"
+.L.data.116:
+  .string "char x=1; x;"
+.L.data.115:
+  .string "sizeof(g2)"
+.L.data.114:
+  .string "sizeof(g1)"
+.L.data.113:
+  .string "g1"
+.L.data.112:
+  .string "int g1=7; g1;"
+.L.data.111:
+  .string "int x=2; { int x=3; } x;"
+.L.data.110:
+  .string "g2[3]"
+.L.data.109:
+  .string "g2[2]"
+.L.data.108:
+  .string "g2[1]"
+.L.data.107:
+  .string "g2[0]"
+.L.data.106:
+  .string "g1"
+.L.data.105:
+  .string "g1"
+.L.data.104:
+  .string "int x[3][4]; sizeof(**x + 1);"
+.L.data.103:
+  .string "int x[3][4]; sizeof **x + 1;"
+.L.data.102:
+  .string "int x[3][4]; sizeof(**x) + 1;"
+.L.data.101:
+  .string "int x[3][4]; sizeof(**x);"
+.L.data.100:
+  .string "int x[3][4]; sizeof(*x);"
+.L.data.99:
+  .string "int x[3][4]; sizeof(x);"
+.L.data.98:
+  .string "int x[4]; sizeof(x);"
+.L.data.97:
+  .string "int *x; sizeof(x);"
+.L.data.96:
+  .string "int x; sizeof x;"
+.L.data.95:
+  .string "int x; sizeof(x);"
+.L.data.94:
+  .string "int x[2][3]; int *y=x; y[6]=6; x[2][0];"
+.L.data.93:
+  .string "int x[2][3]; int *y=x; y[5]=5; x[1][2];"
+.L.data.92:
+  .string "int x[2][3]; int *y=x; y[4]=4; x[1][1];"
+.L.data.91:
+  .string "int x[2][3]; int *y=x; y[3]=3; x[1][0];"
+.L.data.90:
+  .string "int x[2][3]; int *y=x; y[2]=2; x[0][2];"
+.L.data.89:
+  .string "int x[2][3]; int *y=x; y[1]=1; x[0][1];"
+.L.data.88:
+  .string "int x[2][3]; int *y=x; y[0]=0; x[0][0];"
+.L.data.87:
+  .string "int x[3]; *x=3; x[1]=4; 2[x]=5; *(x+2);"
+.L.data.86:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);"
+.L.data.85:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);"
+.L.data.84:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+1);"
+.L.data.83:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *x;"
+.L.data.82:
+  .string "int x[2][3]; int *y=x; *(y+6)=6; **(x+2);"
+.L.data.81:
+  .string "int x[2][3]; int *y=x; *(y+5)=5; *(*(x+1)+2);"
+.L.data.80:
+  .string "int x[2][3]; int *y=x; *(y+4)=4; *(*(x+1)+1);"
+.L.data.79:
+  .string "int x[2][3]; int *y=x; *(y+3)=3; **(x+1);"
+.L.data.78:
+  .string "int x[2][3]; int *y=x; *(y+2)=2; *(*x+2);"
+.L.data.77:
+  .string "int x[2][3]; int *y=x; *(y+1)=1; *(*x+1);"
+.L.data.76:
+  .string "int x[2][3]; int *y=x; *y=0; **x;"
+.L.data.75:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+2);"
+.L.data.74:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+1);"
+.L.data.73:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *x;"
+.L.data.72:
+  .string "int x[2]; int *y=&x; *y=3; *x;"
+.L.data.71:
+  .string "int x=3; int y=5; addx(&x, y);"
+.L.data.70:
+  .string "int x=3; int y=5; *(&y-1)=7; x;"
+.L.data.69:
+  .string "int x=3; int y=5; *(&x+1)=7; y;"
+.L.data.68:
+  .string "int x=3; int *y=&x; *y=5; x;"
+.L.data.67:
+  .string "int x=3; int y=5; int *z=&y; *(z-1);"
+.L.data.66:
+  .string "int x=3; int y=5; int *z=&x; *(z+1);"
+.L.data.65:
+  .string "int x=3; (&x+2)-&x;"
+.L.data.64:
+  .string "int x=3; int y=5; *(&y-1);"
+.L.data.63:
+  .string "int x=3; int y=5; *(1+&x);"
+.L.data.62:
+  .string "int x=3; int y=5; *(&x+1);"
+.L.data.61:
+  .string "int x=3; int *y=&x; int **z=&y; **z;"
+.L.data.60:
+  .string "int x=3; *&x;"
+.L.data.59:
+  .string "int x=2; clamp_add(x, clamp_add(x, 1));"
+.L.data.58:
+  .string "clamp_add(3, -4)"
+.L.data.57:
+  .string "clamp_add(3, 4)"
+.L.data.56:
+  .string "fib(9)"
+.L.data.55:
+  .string "add6(1,2,3,4,5,sub2(9,add6(1,1,1,1,1,1)))"
+.L.data.54:
+  .string "add6(1,2,3,4,5,6)"
+.L.data.53:
+  .string "sub(5, 3)"
+.L.data.52:
+  .string "add(3, 5)"
+.L.data.51:
+  .string "int x[4]; x[3]=6; *(x+1+2);"
+.L.data.50:
+  .string "int x=5; 1*x+0-0;"
+.L.data.49:
+  .string "int x=3; x=5; x=0-x; x;"
+.L.data.48:
+  .string "int x=4; int y=3; y=0-(x+y); y;"
+.L.data.47:
+  .string "int x=3; -x;"
+.L.data.46:
+  .string "int x=3; x*8;"
+.L.data.45:
+  .string "1+(2+(3+(4+(5+(6+(7+add2(3,5)))))))"
+.L.data.44:
+  .string "1+(2+(3+(4+(5+(6+(7+(8+(9+10))))))))"
+.L.data.43:
+  .string "int i=0; int j=0; for (i=0; i<=10; i=i+1) j=i+j; j;"
+.L.data.42:
+  .string "int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} j;"
+.L.data.41:
+  .string "int i=0; i=0; while(i<10) i=i+1; i;"
+.L.data.40:
+  .string "1; {2;} 3;"
+.L.data.39:
+  .string "int x=0; if (2-1) x=2; else x=3; x;"
+.L.data.38:
+  .string "int x=0; if (1) x=2; else x=3; x;"
+.L.data.37:
+  .string "int x=0; if (1-1) x=2; else x=3; x;"
+.L.data.36:
+  .string "int x=0; if (0) x=2; else x=3; x;"
+.L.data.35:
+  .string "ret3();"
+.L.data.34:
+  .string "int foo123=3; int bar=5; foo123+bar;"
+.L.data.33:
+  .string "int foo=3; foo;"
+.L.data.32:
+  .string "int a=3; int z=5; a+z;"
+.L.data.31:
+  .string "int a=3; a;"
+.L.data.30:
+  .string "int a; int z; a=3; z=5; a+z;"
+.L.data.29:
+  .string "int a; a=3; a;"
+.L.data.28:
+  .string "1>=2"
+.L.data.27:
+  .string "1>=1"
+.L.data.26:
+  .string "1>=0"
+.L.data.25:
+  .string "1>2"
+.L.data.24:
+  .string "1>1"
+.L.data.23:
+  .string "1>0"
+.L.data.22:
+  .string "2<=1"
+.L.data.21:
+  .string "1<=1"
+.L.data.20:
+  .string "0<=1"
+.L.data.19:
+  .string "2<1"
+.L.data.18:
+  .string "1<1"
+.L.data.17:
+  .string "0<1"
+.L.data.16:
+  .string "42!=42"
+.L.data.15:
+  .string "0!=1"
+.L.data.14:
+  .string "42==42"
+.L.data.13:
+  .string "0==1"
+.L.data.12:
+  .string "- - +10"
+.L.data.11:
+  .string "- -10"
+.L.data.10:
+  .string "0"
+.L.data.9:
+  .string "(3+5)/2"
+.L.data.8:
+  .string "5*(9-6)"
+.L.data.7:
+  .string "0"
+.L.data.6:
+  .string " 12 + 34 - 5 "
+.L.data.5:
+  .string "0"
+.L.data.4:
+  .string "42"
+.L.data.3:
+  .string "0"
+.L.data.2:
+  .string "int a=3; int z=5; a+z;"
+.L.data.1:
+  .string "%s => %d expected but got %d\012"
+.L.data.0:
+  .string "%s => %d\012"
+g2:
+  .zero 32
+g1:
+  .zero 8
+.text
+.global assert
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-32], rbx
+  mov [rbp-40], r12
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  mov [rbp-8], rdx
+  mov r10, [rbp-24]
+  mov rax, [rbp-16]
+  mov r11, rax
+  cmp r10, r11
+  jne .L.else.assert.1
+  mov r10, offset .L.data.0
+  mov r11, [rbp-8]
+  mov rbx, [rbp-16]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call printf
+  mov r10, rax
+  jmp .L.end.assert.1
+.L.else.assert.1:
+  mov r10, offset .L.data.1
+  mov r11, [rbp-8]
+  mov rbx, [rbp-24]
+  mov r12, [rbp-16]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rcx, r12
+  mov rax, 0
+  call printf
+  mov r10, rax
+  mov rdi, 1
+  mov rax, 0
+  call exit
+  mov r10, rax
+.L.end.assert.1:
+.L.return.assert:
+  mov rbx, [rbp-32]
+  mov r12, [rbp-40]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global ret3
+ret3:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+  mov rax, 3
+  jmp .L.return.ret3
+.L.return.ret3:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global add2
+add2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov r10, [rbp-16]
+  mov r11, [rbp-8]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.add2
+.L.return.add2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sub2
+sub2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov r10, [rbp-16]
+  mov r11, [rbp-8]
+  sub r10, r11
+  mov rax, r10
+  jmp .L.return.sub2
+.L.return.sub2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global add6
+add6:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-48], rdi
+  mov [rbp-40], rsi
+  mov [rbp-32], rdx
+  mov [rbp-24], rcx
+  mov [rbp-16], r8
+  mov [rbp-8], r9
+  mov r10, [rbp-48]
+  mov r11, [rbp-40]
+  add r10, r11
+  mov r11, [rbp-32]
+  add r10, r11
+  mov r11, [rbp-24]
+  add r10, r11
+  mov r11, [rbp-16]
+  add r10, r11
+  mov r11, [rbp-8]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.add6
+.L.return.add6:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global addx
+addx:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov r10, [rbp-16]
+  mov r10, [r10]
+  mov r11, [rbp-8]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.addx
+.L.return.addx:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sub_char
+sub_char:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-3], dil
+  mov [rbp-2], sil
+  mov [rbp-1], dl
+  movsx rax, byte ptr [rbp-3]
+  mov r10, rax
+  movsx rax, byte ptr [rbp-2]
+  mov r11, rax
+  sub r10, r11
+  movsx rax, byte ptr [rbp-1]
+  mov r11, rax
+  sub r10, r11
+  mov rax, r10
+  jmp .L.return.sub_char
+.L.return.sub_char:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global clamp_add
+clamp_add:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-32], rbx
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  lea r10, [rbp-8]
+  mov r11, [rbp-24]
+  mov rbx, [rbp-16]
+  add r11, rbx
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  mov r10, rax
+  cmp r10, 0
+  jge .L.end.clamp_add.1
+  lea r10, [rbp-8]
+  mov r11, 0
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+.L.end.clamp_add.1:
+  mov r10, [rbp-8]
+  mov rax, r10
+  jmp .L.return.clamp_add
+.L.return.clamp_add:
+  mov rbx, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global fib
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rbx
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  mov r10, rax
+  cmp r10, 1
+  jg .L.end.fib.1
+  mov rax, 1
+  jmp .L.return.fib
+.L.end.fib.1:
+  mov r10, [rbp-8]
+  sub r10, 1
+  mov rdi, r10
+  mov rax, 0
+  call fib
+  mov rbx, rax
+  mov r10, [rbp-8]
+  sub r10, 2
+  mov rdi, r10
+  mov rax, 0
+  call fib
+  mov r10, rax
+  mov rax, rbx
+  add rax, r10
+  mov r10, rax
+  jmp .L.return.fib
+.L.return.fib:
+  mov rbx, [rbp-16]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sum_to
+sum_to:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-24], rbx
+.L.tail.sum_to:
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov rax, [rbp-16]
+  mov r10, rax
+  cmp r10, 0
+  jne .L.end.sum_to.1
+  mov r10, [rbp-8]
+  mov rax, r10
+  jmp .L.return.sum_to
+.L.end.sum_to.1:
+  mov r10, [rbp-16]
+  sub r10, 1
+  mov r11, [rbp-8]
+  mov rbx, [rbp-16]
+  mov rax, r11
+  add rax, rbx
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  jmp .L.tail.sum_to
+.L.return.sum_to:
+  mov rbx, [rbp-24]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global rot5
+rot5:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov [rbp-56], rbx
+  mov [rbp-64], r12
+  mov [rbp-72], r13
+  mov [rbp-80], r14
+.L.tail.rot5:
+  mov [rbp-48], rdi
+  mov [rbp-40], rsi
+  mov [rbp-32], rdx
+  mov [rbp-24], rcx
+  mov [rbp-16], r8
+  mov [rbp-8], r9
+  mov rax, [rbp-48]
+  mov r10, rax
+  cmp r10, 0
+  jne .L.end.rot5.1
+  mov r10, [rbp-40]
+  imul r10, 10000
+  mov r11, [rbp-32]
+  imul r11, 1000
+  add r10, r11
+  mov r11, [rbp-24]
+  imul r11, 100
+  add r10, r11
+  mov r11, [rbp-16]
+  imul r11, 10
+  add r10, r11
+  mov r11, [rbp-8]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.rot5
+.L.end.rot5.1:
+  mov r10, [rbp-48]
+  sub r10, 1
+  mov r11, [rbp-32]
+  mov rbx, [rbp-24]
+  mov r12, [rbp-16]
+  mov r13, [rbp-8]
+  mov rax, [rbp-40]
+  mov r14, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rcx, r12
+  mov r8, r13
+  mov r9, r14
+  jmp .L.tail.rot5
+.L.return.rot5:
+  mov rbx, [rbp-56]
+  mov r12, [rbp-64]
+  mov r13, [rbp-72]
+  mov r14, [rbp-80]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global is_even
+is_even:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  mov r10, rax
+  cmp r10, 0
+  jne .L.end.is_even.1
+  mov rax, 1
+  jmp .L.return.is_even
+.L.end.is_even.1:
+  mov r10, [rbp-8]
+  sub r10, 1
+  mov rdi, r10
+  mov rsp, rbp
+  pop rbp
+  mov rax, 0
+  jmp is_odd
+.L.return.is_even:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global is_odd
+is_odd:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  mov r10, rax
+  cmp r10, 0
+  jne .L.end.is_odd.1
+  mov rax, 0
+  jmp .L.return.is_odd
+.L.end.is_odd.1:
+  mov r10, [rbp-8]
+  sub r10, 1
+  mov rdi, r10
+  mov rsp, rbp
+  pop rbp
+  mov rax, 0
+  jmp is_even
+.L.return.is_odd:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global via_ptr
+via_ptr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-32], rdi
+  lea r10, [rbp-24]
+  mov r11, [rbp-32]
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  lea r10, [rbp-16]
+  lea r11, [rbp-24]
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  lea r10, [rbp-8]
+  mov rax, r10
+  mov rdi, 1
+  mov [rax], rdi
+  mov r10, [rbp-16]
+  mov r10, [r10]
+  mov r11, [rbp-8]
+  add r10, r11
+  mov rax, r10
+  jmp .L.return.via_ptr
+.L.return.via_ptr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global pick
+pick:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rdi
+  lea r10, [rbp-8]
+  mov r11, [rbp-8]
+  add r11, 1
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  jmp .L.cond.pick.1
+.L.begin.pick.1:
+  mov r10, [rbp-8]
+  mov rax, r10
+  jmp .L.return.pick
+.L.cond.pick.1:
+  jmp .L.begin.pick.1
+.L.return.pick:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global count_up
+count_up:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  lea r10, [rbp-8]
+  mov r11, 0
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  jmp .L.cond.count_up.1
+.L.begin.count_up.1:
+  lea r10, [rbp-8]
+  mov r11, [rbp-8]
+  add r11, 1
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  mov r10, [rbp-8]
+  mov rax, [rbp-16]
+  mov r11, rax
+  cmp r10, r11
+  jne .L.end.count_up.2
+  mov r10, [rbp-8]
+  mov rax, r10
+  jmp .L.return.count_up
+.L.end.count_up.2:
+.L.cond.count_up.1:
+  jmp .L.begin.count_up.1
+.L.return.count_up:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global count_const
+count_const:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  lea r10, [rbp-8]
+  mov r11, 0
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  jmp .L.cond.count_const.1
+.L.begin.count_const.1:
+  lea r10, [rbp-8]
+  mov r11, [rbp-8]
+  add r11, 1
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  mov r10, [rbp-8]
+  mov rax, [rbp-16]
+  mov r11, rax
+  cmp r10, r11
+  jne .L.end.count_const.2
+  mov r10, [rbp-8]
+  shl r10, 1
+  mov rax, r10
+  jmp .L.return.count_const
+.L.end.count_const.2:
+.L.cond.count_const.1:
+  jmp .L.begin.count_const.1
+.L.return.count_const:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global both_return
+both_return:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  mov r10, rax
+  cmp r10, 0
+  je .L.else.both_return.1
+  mov rax, 1
+  jmp .L.return.both_return
+  jmp .L.end.both_return.1
+.L.else.both_return.1:
+  mov rax, 2
+  jmp .L.return.both_return
+.L.end.both_return.1:
+.L.return.both_return:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 608
+  mov [rbp-544], rbx
+  mov [rbp-552], r12
+  mov [rbp-560], r13
+  mov [rbp-568], r14
+  mov [rbp-576], r15
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  mov r11, [rbp-280]
+  mov rbx, [rbp-272]
+  add r11, rbx
+  mov rbx, offset .L.data.2
+  mov rdi, 8
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.3
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.4
+  mov rdi, 42
+  mov rsi, 42
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.5
+  mov rdi, 5
+  mov rsi, 5
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.6
+  mov rdi, 41
+  mov rsi, 41
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.7
+  mov rdi, 5
+  mov rsi, 5
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.8
+  mov rdi, 15
+  mov rsi, 15
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.9
+  mov rdi, 4
+  mov rsi, 4
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.10
+  mov rdi, -10
+  mov rsi, -10
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.11
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.12
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.13
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.14
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.15
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.16
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.17
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.18
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.19
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.20
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.21
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.22
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.23
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.24
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.25
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.26
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.27
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.28
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.29
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  mov r11, [rbp-280]
+  mov rbx, [rbp-272]
+  add r11, rbx
+  mov rbx, offset .L.data.30
+  mov rdi, 8
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.31
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  mov r11, [rbp-280]
+  mov rbx, [rbp-272]
+  add r11, rbx
+  mov rbx, offset .L.data.32
+  mov rdi, 8
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.33
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  mov r11, [rbp-280]
+  mov rbx, [rbp-272]
+  add r11, rbx
+  mov rbx, offset .L.data.34
+  mov rdi, 8
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.35
+  mov rdi, 3
+  mov rsi, 3
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.36
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.37
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.38
+  mov rdi, 2
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.39
+  mov rdi, 2
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, 1
+  mov r11, 2
+  mov rbx, offset .L.data.40
+  mov rdi, 3
+  mov rsi, 3
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 10
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rax, [rbp-272]
+  mov rbx, rax
+  mov r11, rbx
+  jmp .L.cond.main.1
+.L.begin.main.1:
+  mov rbx, r11
+  mov rax, rbx
+  add rax, 1
+  mov rbx, rax
+  mov r11, rbx
+.L.cond.main.1:
+  mov rbx, r11
+  cmp rbx, 10
+  jl .L.begin.main.1
+  lea rbx, [rbp-272]
+  mov rax, rbx
+  mov rdi, r11
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.41
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 55
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rax, [rbp-280]
+  mov rbx, rax
+  mov r11, rbx
+  jmp .L.cond.main.2
+.L.begin.main.2:
+  lea rbx, [rbp-272]
+  mov r12, r11
+  mov r13, [rbp-272]
+  add r12, r13
+  mov rax, rbx
+  mov rdi, r12
+  mov [rax], rdi
+  mov rbx, r11
+  mov rax, rbx
+  add rax, 1
+  mov rbx, rax
+  mov r11, rbx
+.L.cond.main.2:
+  mov rbx, r11
+  cmp rbx, 10
+  jle .L.begin.main.2
+  lea rbx, [rbp-280]
+  mov rax, rbx
+  mov rdi, r11
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.42
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 55
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rax, [rbp-280]
+  mov rbx, rax
+  mov r11, rbx
+  jmp .L.cond.main.3
+.L.begin.main.3:
+  lea rbx, [rbp-272]
+  mov r12, r11
+  mov r13, [rbp-272]
+  add r12, r13
+  mov rax, rbx
+  mov rdi, r12
+  mov [rax], rdi
+  mov rbx, r11
+  mov rax, rbx
+  add rax, 1
+  mov rbx, rax
+  mov r11, rbx
+.L.cond.main.3:
+  mov rbx, r11
+  cmp rbx, 10
+  jle .L.begin.main.3
+  lea rbx, [rbp-280]
+  mov rax, rbx
+  mov rdi, r11
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.43
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.44
+  mov rdi, 55
+  mov rsi, 55
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rax, 36
+  mov [rbp-584], rax
+  mov rax, 1
+  mov [rbp-592], rax
+  mov rax, 2
+  mov [rbp-600], rax
+  mov r12, 3
+  mov r13, 4
+  mov r14, 5
+  mov r15, 6
+  mov r10, 7
+  lea r11, [rbp-256]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-248]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  mov r11, [rbp-256]
+  mov rbx, [rbp-248]
+  add r11, rbx
+  add r10, r11
+  mov rax, r15
+  add rax, r10
+  mov r10, rax
+  mov rax, r14
+  add rax, r10
+  mov r10, rax
+  mov rax, r13
+  add rax, r10
+  mov r10, rax
+  mov rax, r12
+  add rax, r10
+  mov r10, rax
+  mov rax, [rbp-600]
+  add rax, r10
+  mov r10, rax
+  mov rax, [rbp-592]
+  add rax, r10
+  mov r10, rax
+  mov r11, offset .L.data.45
+  mov rdi, [rbp-584]
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  shl r11, 3
+  mov rbx, offset .L.data.46
+  mov rdi, 24
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rax, r11
+  neg rax
+  mov r11, rax
+  mov rbx, offset .L.data.47
+  mov rdi, -3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, -7
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 4
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rbx, [rbp-280]
+  mov r12, [rbp-272]
+  add rbx, r12
+  mov rax, rbx
+  neg rax
+  mov rbx, rax
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.48
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, -5
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rbx, [rbp-272]
+  mov rax, rbx
+  neg rax
+  mov rbx, rax
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.49
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.50
+  mov rdi, 5
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-296]
+  add r11, 24
+  mov rax, r11
+  mov rdi, 6
+  mov [rax], rdi
+  lea r11, [rbp-296]
+  add r11, 24
+  mov r11, [r11]
+  mov rbx, offset .L.data.51
+  mov rdi, 6
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-240]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-232]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  mov r11, [rbp-240]
+  mov rbx, [rbp-232]
+  add r11, rbx
+  mov rbx, offset .L.data.52
+  mov rdi, 8
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-224]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-216]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  mov r11, [rbp-224]
+  mov rbx, [rbp-216]
+  sub r11, rbx
+  mov rbx, offset .L.data.53
+  mov rdi, 2
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 21
+  lea r11, [rbp-208]
+  mov rax, r11
+  mov rdi, 1
+  mov [rax], rdi
+  lea r11, [rbp-200]
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  lea r11, [rbp-192]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-184]
+  mov rax, r11
+  mov rdi, 4
+  mov [rax], rdi
+  lea r11, [rbp-176]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-168]
+  mov rax, r11
+  mov rdi, 6
+  mov [rax], rdi
+  mov r11, [rbp-208]
+  mov rbx, [rbp-200]
+  add r11, rbx
+  mov rbx, [rbp-192]
+  add r11, rbx
+  mov rbx, [rbp-184]
+  add r11, rbx
+  mov rbx, [rbp-176]
+  add r11, rbx
+  mov rbx, [rbp-168]
+  add r11, rbx
+  mov rbx, offset .L.data.54
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 18
+  lea r11, [rbp-96]
+  mov rax, r11
+  mov rdi, 1
+  mov [rax], rdi
+  lea r11, [rbp-88]
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  lea r11, [rbp-80]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-72]
+  mov rax, r11
+  mov rdi, 4
+  mov [rax], rdi
+  lea r11, [rbp-64]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-56]
+  lea rbx, [rbp-112]
+  mov rax, rbx
+  mov rdi, 9
+  mov [rax], rdi
+  lea rbx, [rbp-104]
+  lea r12, [rbp-160]
+  mov rax, r12
+  mov rdi, 1
+  mov [rax], rdi
+  lea r12, [rbp-152]
+  mov rax, r12
+  mov rdi, 1
+  mov [rax], rdi
+  lea r12, [rbp-144]
+  mov rax, r12
+  mov rdi, 1
+  mov [rax], rdi
+  lea r12, [rbp-136]
+  mov rax, r12
+  mov rdi, 1
+  mov [rax], rdi
+  lea r12, [rbp-128]
+  mov rax, r12
+  mov rdi, 1
+  mov [rax], rdi
+  lea r12, [rbp-120]
+  mov rax, r12
+  mov rdi, 1
+  mov [rax], rdi
+  mov r12, [rbp-160]
+  mov r13, [rbp-152]
+  add r12, r13
+  mov r13, [rbp-144]
+  add r12, r13
+  mov r13, [rbp-136]
+  add r12, r13
+  mov r13, [rbp-128]
+  add r12, r13
+  mov r13, [rbp-120]
+  add r12, r13
+  mov rax, rbx
+  mov rdi, r12
+  mov [rax], rdi
+  mov rbx, [rbp-112]
+  mov r12, [rbp-104]
+  sub rbx, r12
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-96]
+  mov rbx, [rbp-88]
+  add r11, rbx
+  mov rbx, [rbp-80]
+  add r11, rbx
+  mov rbx, [rbp-72]
+  add r11, rbx
+  mov rbx, [rbp-64]
+  add r11, rbx
+  mov rbx, [rbp-56]
+  add r11, rbx
+  mov rbx, offset .L.data.55
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, 55
+  mov rdi, 9
+  mov rax, 0
+  call fib
+  mov r10, rax
+  mov r11, offset .L.data.56
+  mov rdi, rbx
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 7
+  lea r11, [rbp-48]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-40]
+  mov rax, r11
+  mov rdi, 4
+  mov [rax], rdi
+  lea r11, [rbp-32]
+  mov rbx, [rbp-48]
+  mov r12, [rbp-40]
+  add rbx, r12
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov rax, [rbp-32]
+  mov r11, rax
+  cmp r11, 0
+  jge .L.end.main.4
+  lea r11, [rbp-32]
+  mov rbx, 0
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+.L.end.main.4:
+  mov r11, [rbp-32]
+  mov rbx, offset .L.data.57
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 0
+  lea r11, [rbp-24]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-16]
+  mov rax, r11
+  mov rdi, -4
+  mov [rax], rdi
+  lea r11, [rbp-8]
+  mov rbx, [rbp-24]
+  mov r12, [rbp-16]
+  add rbx, r12
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  mov r11, rax
+  cmp r11, 0
+  jge .L.end.main.5
+  lea r11, [rbp-8]
+  mov rbx, 0
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+.L.end.main.5:
+  mov r11, [rbp-8]
+  mov rbx, offset .L.data.58
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  lea r11, [rbp-320]
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  mov rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  lea rbx, [rbp-312]
+  mov r12, [rbp-320]
+  mov rax, rbx
+  mov rdi, r12
+  mov [rax], rdi
+  lea rbx, [rbp-304]
+  mov rax, rbx
+  mov rdi, 1
+  mov [rax], rdi
+  lea rbx, [rbp-296]
+  mov r12, [rbp-312]
+  mov r13, [rbp-304]
+  add r12, r13
+  mov rax, rbx
+  mov rdi, r12
+  mov [rax], rdi
+  mov rax, [rbp-296]
+  mov rbx, rax
+  cmp rbx, 0
+  jge .L.end.main.6
+  lea rbx, [rbp-296]
+  mov r12, 0
+  mov rax, rbx
+  mov rdi, r12
+  mov [rax], rdi
+.L.end.main.6:
+  mov rbx, [rbp-296]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rbx, [rbp-288]
+  mov r12, [rbp-280]
+  add rbx, r12
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov rax, [rbp-272]
+  mov r11, rax
+  cmp r11, 0
+  jge .L.end.main.7
+  lea r11, [rbp-272]
+  mov rbx, 0
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+.L.end.main.7:
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.59
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.60
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  lea r11, [rbp-288]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  lea rbx, [rbp-288]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  lea rbx, [rbp-280]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov r11, [r11]
+  mov r11, [r11]
+  mov rbx, offset .L.data.61
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  add r11, 8
+  mov r11, [r11]
+  mov rbx, offset .L.data.62
+  mov rdi, 5
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  add r11, 8
+  mov r11, [r11]
+  mov rbx, offset .L.data.63
+  mov rdi, 5
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  add r11, -8
+  mov r11, [r11]
+  mov rbx, offset .L.data.64
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  add r11, 16
+  lea rbx, [rbp-272]
+  sub r11, rbx
+  mov rax, r11
+  mov rdi, 8
+  cqo
+  idiv rdi
+  mov r11, rax
+  mov rbx, offset .L.data.65
+  mov rdi, 2
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  lea r11, [rbp-288]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  lea rbx, [rbp-288]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 8
+  mov r11, [r11]
+  mov rbx, offset .L.data.66
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  lea r11, [rbp-288]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  lea rbx, [rbp-280]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, -8
+  mov r11, [r11]
+  mov rbx, offset .L.data.67
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  lea rbx, [rbp-280]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  mov r11, [rbp-280]
+  mov rbx, offset .L.data.68
+  mov rdi, 5
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 7
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.69
+  mov rdi, 7
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  add r11, -8
+  mov rax, r11
+  mov rdi, 7
+  mov [rax], rdi
+  mov r11, [rbp-280]
+  mov rbx, offset .L.data.70
+  mov rdi, 7
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 8
+  lea r11, [rbp-296]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  lea rbx, [rbp-296]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rbx, [rbp-288]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-280]
+  mov r11, [r11]
+  mov rbx, [rbp-272]
+  add r11, rbx
+  mov rbx, offset .L.data.71
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-288]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  mov r11, [rbp-288]
+  mov rbx, offset .L.data.72
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-288]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 4
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 16
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  mov r11, [rbp-288]
+  mov rbx, offset .L.data.73
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  lea r11, [rbp-288]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 4
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 16
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 8
+  mov r11, [r11]
+  mov rbx, offset .L.data.74
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  lea r11, [rbp-288]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 4
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 16
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 16
+  mov r11, [r11]
+  mov rbx, offset .L.data.75
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov r11, [rbp-320]
+  mov rbx, offset .L.data.76
+  mov rdi, 0
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 1
+  mov [rax], rdi
+  lea r11, [rbp-320]
+  add r11, 8
+  mov r11, [r11]
+  mov rbx, offset .L.data.77
+  mov rdi, 1
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 16
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  lea r11, [rbp-320]
+  add r11, 16
+  mov r11, [r11]
+  mov rbx, offset .L.data.78
+  mov rdi, 2
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 24
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-320]
+  add r11, 24
+  mov r11, [r11]
+  mov rbx, offset .L.data.79
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 32
+  mov rax, r11
+  mov rdi, 4
+  mov [rax], rdi
+  lea r11, [rbp-320]
+  add r11, 24
+  add r11, 8
+  mov r11, [r11]
+  mov rbx, offset .L.data.80
+  mov rdi, 4
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 40
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-320]
+  add r11, 24
+  add r11, 16
+  mov r11, [r11]
+  mov rbx, offset .L.data.81
+  mov rdi, 5
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 48
+  mov rax, r11
+  mov rdi, 6
+  mov [rax], rdi
+  lea r11, [rbp-320]
+  add r11, 48
+  mov r11, [r11]
+  mov rbx, offset .L.data.82
+  mov rdi, 6
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-288]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 4
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 16
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  mov r11, [rbp-288]
+  mov rbx, offset .L.data.83
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 4
+  lea r11, [rbp-288]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 4
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 16
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 8
+  mov r11, [r11]
+  mov rbx, offset .L.data.84
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  lea r11, [rbp-288]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 4
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 16
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 16
+  mov r11, [r11]
+  mov rbx, offset .L.data.85
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  lea r11, [rbp-288]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 4
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 16
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 16
+  mov r11, [r11]
+  mov rbx, offset .L.data.86
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  lea r11, [rbp-288]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 4
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 16
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 16
+  mov r11, [r11]
+  mov rbx, offset .L.data.87
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov r11, [rbp-320]
+  mov rbx, offset .L.data.88
+  mov rdi, 0
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 1
+  mov [rax], rdi
+  lea r11, [rbp-320]
+  add r11, 8
+  mov r11, [r11]
+  mov rbx, offset .L.data.89
+  mov rdi, 1
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 16
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  lea r11, [rbp-320]
+  add r11, 16
+  mov r11, [r11]
+  mov rbx, offset .L.data.90
+  mov rdi, 2
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 24
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-320]
+  add r11, 24
+  mov r11, [r11]
+  mov rbx, offset .L.data.91
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 32
+  mov rax, r11
+  mov rdi, 4
+  mov [rax], rdi
+  lea r11, [rbp-320]
+  add r11, 24
+  add r11, 8
+  mov r11, [r11]
+  mov rbx, offset .L.data.92
+  mov rdi, 4
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 40
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-320]
+  add r11, 24
+  add r11, 16
+  mov r11, [r11]
+  mov rbx, offset .L.data.93
+  mov rdi, 5
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 48
+  mov rax, r11
+  mov rdi, 6
+  mov [rax], rdi
+  lea r11, [rbp-320]
+  add r11, 48
+  mov r11, [r11]
+  mov rbx, offset .L.data.94
+  mov rdi, 6
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.95
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.96
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.97
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.98
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.99
+  mov rdi, 96
+  mov rsi, 96
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.100
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.101
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.102
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.103
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.104
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset g1
+  mov r11, [r11]
+  mov rbx, offset .L.data.105
+  mov rdi, 0
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset g1
+  mov rax, r10
+  mov rdi, 3
+  mov [rax], rdi
+  mov r11, offset g1
+  mov r11, [r11]
+  mov rbx, offset .L.data.106
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset g2
+  mov rax, r10
+  mov rdi, 0
+  mov [rax], rdi
+  mov r10, offset g2
+  add r10, 8
+  mov rax, r10
+  mov rdi, 1
+  mov [rax], rdi
+  mov r10, offset g2
+  add r10, 16
+  mov rax, r10
+  mov rdi, 2
+  mov [rax], rdi
+  mov r10, offset g2
+  add r10, 24
+  mov rax, r10
+  mov rdi, 3
+  mov [rax], rdi
+  mov r11, offset g2
+  mov r11, [r11]
+  mov rbx, offset .L.data.107
+  mov rdi, 0
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset g2
+  add r11, 8
+  mov r11, [r11]
+  mov rbx, offset .L.data.108
+  mov rdi, 1
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset g2
+  add r11, 16
+  mov r11, [r11]
+  mov rbx, offset .L.data.109
+  mov rdi, 2
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset g2
+  add r11, 24
+  mov r11, [r11]
+  mov rbx, offset .L.data.110
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.111
+  mov rdi, 2
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 7
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.112
+  mov rdi, 7
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset g1
+  mov r11, [r11]
+  mov rbx, offset .L.data.113
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.114
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.115
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-260]
+  mov rax, r11
+  mov rdi, 1
+  mov [rax], dil
+  movsx rax, byte ptr [rbp-260]
+  mov r11, rax
+  mov rbx, offset .L.data.116
+  mov rdi, 1
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-261]
+  mov rax, r11
+  mov rdi, 1
+  mov [rax], dil
+  lea r11, [rbp-260]
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], dil
+  movsx rax, byte ptr [rbp-261]
+  mov r11, rax
+  mov rbx, offset .L.data.117
+  mov rdi, 1
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-261]
+  mov rax, r11
+  mov rdi, 1
+  mov [rax], dil
+  lea r11, [rbp-260]
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], dil
+  movsx rax, byte ptr [rbp-260]
+  mov r11, rax
+  mov rbx, offset .L.data.118
+  mov rdi, 2
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.119
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.120
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  lea r11, [rbp-259]
+  mov rax, r11
+  mov rdi, 7
+  mov [rax], dil
+  lea r11, [rbp-258]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], dil
+  lea r11, [rbp-257]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], dil
+  movsx rax, byte ptr [rbp-259]
+  mov r11, rax
+  movsx rax, byte ptr [rbp-258]
+  mov rbx, rax
+  sub r11, rbx
+  movsx rax, byte ptr [rbp-257]
+  mov rbx, rax
+  sub r11, rbx
+  mov rbx, offset .L.data.121
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset .L.data.122
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.123
+  mov rdi, 97
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset .L.data.124
+  add r11, 1
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.125
+  mov rdi, 98
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset .L.data.126
+  add r11, 2
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.127
+  mov rdi, 99
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset .L.data.128
+  add r11, 3
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.129
+  mov rdi, 0
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.131
+  mov rdi, 4
+  mov rsi, 4
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset .L.data.132
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.133
+  mov rdi, 7
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset .L.data.134
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.135
+  mov rdi, 8
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset .L.data.136
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.137
+  mov rdi, 9
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset .L.data.138
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.139
+  mov rdi, 10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset .L.data.140
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.141
+  mov rdi, 11
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset .L.data.142
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.143
+  mov rdi, 12
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset .L.data.144
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.145
+  mov rdi, 13
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset .L.data.146
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.147
+  mov rdi, 27
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset .L.data.148
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.149
+  mov rdi, 0
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset .L.data.150
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.151
+  mov rdi, 106
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset .L.data.152
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.153
+  mov rdi, 107
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset .L.data.154
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.155
+  mov rdi, 108
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.156
+  mov rdi, 2
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 4
+  mov [rax], rdi
+  mov r11, [rbp-280]
+  mov rbx, offset .L.data.157
+  mov rdi, 2
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.158
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-312]
+  add rbx, 16
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  lea rbx, [rbp-312]
+  sub r11, rbx
+  mov rax, r11
+  mov rdi, 8
+  cqo
+  idiv rdi
+  mov r11, rax
+  mov rbx, offset .L.data.159
+  mov rdi, 2
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-280]
+  add r11, 0
+  mov rax, r11
+  mov rdi, 1
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  add r11, 0
+  mov r11, [r11]
+  mov rbx, offset .L.data.160
+  mov rdi, 1
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-280]
+  add r11, 0
+  mov rax, r11
+  mov rdi, 1
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  add r11, 8
+  mov r11, [r11]
+  mov rbx, offset .L.data.161
+  mov rdi, 2
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  lea r11, [rbp-288]
+  add r11, 0
+  mov rax, r11
+  mov rdi, 1
+  mov [rax], dil
+  lea r11, [rbp-288]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 16
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], dil
+  lea r11, [rbp-288]
+  add r11, 0
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.162
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 2
+  lea r11, [rbp-288]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 1
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 16
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], dil
+  lea r11, [rbp-288]
+  add r11, 8
+  mov r11, [r11]
+  mov rbx, offset .L.data.163
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  lea r11, [rbp-288]
+  add r11, 0
+  mov rax, r11
+  mov rdi, 1
+  mov [rax], dil
+  lea r11, [rbp-288]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  add r11, 16
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], dil
+  lea r11, [rbp-288]
+  add r11, 16
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  mov rbx, offset .L.data.164
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  lea r11, [rbp-320]
+  add r11, 0
+  mov r11, [r11]
+  mov rbx, offset .L.data.165
+  mov rdi, 0
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 1
+  mov [rax], rdi
+  lea r11, [rbp-320]
+  add r11, 8
+  mov r11, [r11]
+  mov rbx, offset .L.data.166
+  mov rdi, 1
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 16
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  lea r11, [rbp-320]
+  add r11, 16
+  add r11, 0
+  mov r11, [r11]
+  mov rbx, offset .L.data.167
+  mov rdi, 2
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 24
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  lea r11, [rbp-320]
+  add r11, 16
+  add r11, 8
+  mov r11, [r11]
+  mov rbx, offset .L.data.168
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-336]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  lea r11, [rbp-336]
+  add r11, 0
+  mov rax, r11
+  mov rdi, 6
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov r11, [r11]
+  mov rbx, offset .L.data.169
+  mov rdi, 6
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  lea rbx, [rbp-336]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  lea r11, [rbp-336]
+  add r11, 24
+  mov rax, r11
+  mov rdi, 7
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 24
+  mov r11, [r11]
+  mov rbx, offset .L.data.170
+  mov rdi, 7
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  add r11, 0
+  add r11, 0
+  mov rax, r11
+  mov rdi, 6
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  add r11, 0
+  add r11, 0
+  mov r11, [r11]
+  mov rbx, offset .L.data.171
+  mov rdi, 6
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.172
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.173
+  mov rdi, 16
+  mov rsi, 16
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.174
+  mov rdi, 24
+  mov rsi, 24
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.175
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.176
+  mov rdi, 48
+  mov rsi, 48
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.177
+  mov rdi, 2
+  mov rsi, 2
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.178
+  mov rdi, 16
+  mov rsi, 16
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.179
+  mov rdi, 16
+  mov rsi, 16
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, offset .L.data.180
+  mov rdi, 16
+  mov rsi, 16
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 7
+  lea r11, [rbp-280]
+  add r11, 0
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], dil
+  lea r11, [rbp-280]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  add r11, 0
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  lea rbx, [rbp-280]
+  add rbx, 8
+  mov rbx, [rbx]
+  add r11, rbx
+  mov rbx, offset .L.data.181
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 3
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 1
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rbx, [rbp-280]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rbx, [rbp-272]
+  mov r12, [rbp-280]
+  add rbx, r12
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.182
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 55
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rax, [rbp-280]
+  mov rbx, rax
+  mov r11, rbx
+  jmp .L.cond.main.8
+.L.begin.main.8:
+  lea rbx, [rbp-272]
+  mov r12, [rbp-272]
+  mov r13, r11
+  add r12, r13
+  mov rax, rbx
+  mov rdi, r12
+  mov [rax], rdi
+  mov rbx, r11
+  mov rax, rbx
+  add rax, 1
+  mov rbx, rax
+  mov r11, rbx
+.L.cond.main.8:
+  mov rbx, r11
+  cmp rbx, 10
+  jl .L.begin.main.8
+  lea rbx, [rbp-280]
+  mov rax, rbx
+  mov rdi, r11
+  mov [rax], rdi
+  mov r11, [rbp-280]
+  mov rbx, [rbp-272]
+  add r11, rbx
+  mov rbx, offset .L.data.183
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 18
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rax, [rbp-288]
+  mov rbx, rax
+  mov r11, rbx
+  jmp .L.cond.main.9
+.L.begin.main.9:
+  lea rbx, [rbp-280]
+  mov rax, rbx
+  mov rdi, 0
+  mov [rax], rdi
+  mov rax, [rbp-280]
+  mov r12, rax
+  mov rbx, r12
+  jmp .L.cond.main.10
+.L.begin.main.10:
+  lea r12, [rbp-272]
+  mov r13, [rbp-272]
+  mov r14, r11
+  mov r15, rbx
+  imul r14, r15
+  add r13, r14
+  mov rax, r12
+  mov rdi, r13
+  mov [rax], rdi
+  mov r12, rbx
+  mov rax, r12
+  add rax, 1
+  mov r12, rax
+  mov rbx, r12
+.L.cond.main.10:
+  mov r12, rbx
+  cmp r12, 4
+  jl .L.begin.main.10
+  lea r12, [rbp-280]
+  mov rax, r12
+  mov rdi, rbx
+  mov [rax], rdi
+  mov rbx, r11
+  mov rax, rbx
+  add rax, 1
+  mov rbx, rax
+  mov r11, rbx
+.L.cond.main.9:
+  mov rbx, r11
+  cmp rbx, 3
+  jl .L.begin.main.9
+  lea rbx, [rbp-288]
+  mov rax, rbx
+  mov rdi, r11
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.184
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 30
+  lea r11, [rbp-312]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rax, [rbp-312]
+  mov rbx, rax
+  mov r11, rbx
+  lea rbx, [rbp-304]
+  jmp .L.cond.main.11
+.L.begin.main.11:
+  mov r12, r11
+  lea r12, [rbx+r12*8]
+  mov r13, r11
+  mov r14, r11
+  imul r13, r14
+  mov rax, r12
+  mov rdi, r13
+  mov [rax], rdi
+  mov r12, r11
+  mov rax, r12
+  add rax, 1
+  mov r12, rax
+  mov r11, r12
+.L.cond.main.11:
+  mov r12, r11
+  cmp r12, 5
+  jl .L.begin.main.11
+  lea r12, [rbp-312]
+  mov rax, r12
+  mov rdi, r11
+  mov [rax], rdi
+  lea r11, [rbp-304]
+  add r11, 32
+  mov r11, [r11]
+  lea rbx, [rbp-304]
+  add rbx, 24
+  mov rbx, [rbx]
+  add r11, rbx
+  mov rbx, [rbp-312]
+  add r11, rbx
+  mov rbx, offset .L.data.185
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 27
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rax, [rbp-280]
+  mov rbx, rax
+  mov r11, rbx
+  jmp .L.cond.main.12
+.L.begin.main.12:
+  mov rbx, r11
+  cmp rbx, 3
+  jne .L.end.main.13
+  mov rbx, 7
+  mov r11, rbx
+.L.end.main.13:
+  lea rbx, [rbp-272]
+  mov r12, [rbp-272]
+  mov r13, r11
+  add r12, r13
+  mov rax, rbx
+  mov rdi, r12
+  mov [rax], rdi
+  mov rbx, r11
+  mov rax, rbx
+  add rax, 1
+  mov rbx, rax
+  mov r11, rbx
+.L.cond.main.12:
+  mov rbx, r11
+  cmp rbx, 10
+  jl .L.begin.main.12
+  lea rbx, [rbp-280]
+  mov rax, rbx
+  mov rdi, r11
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.186
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 5
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rax, [rbp-272]
+  mov rbx, rax
+  mov r11, rbx
+  mov rbx, offset g2
+  jmp .L.cond.main.14
+.L.begin.main.14:
+  mov r12, r11
+  lea r12, [rbx+r12*8]
+  mov r13, r11
+  add r13, 1
+  mov rax, r12
+  mov rdi, r13
+  mov [rax], rdi
+  mov r12, r11
+  mov rax, r12
+  add rax, 1
+  mov r12, rax
+  mov r11, r12
+.L.cond.main.14:
+  mov r12, r11
+  cmp r12, 4
+  jl .L.begin.main.14
+  lea r12, [rbp-272]
+  mov rax, r12
+  mov rdi, r11
+  mov [rax], rdi
+  mov r11, offset g2
+  mov r11, [r11]
+  mov rbx, offset g2
+  add rbx, 24
+  mov rbx, [rbx]
+  add r11, rbx
+  mov rbx, offset .L.data.187
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 6
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rax, [rbp-272]
+  mov rbx, rax
+  mov r11, rbx
+  lea rbx, [rbp-276]
+  jmp .L.cond.main.15
+.L.begin.main.15:
+  mov r12, r11
+  lea r12, [rbx+r12*1]
+  mov r13, r11
+  mov rax, r12
+  mov rdi, r13
+  mov [rax], dil
+  mov r12, r11
+  mov rax, r12
+  add rax, 1
+  mov r12, rax
+  mov r11, r12
+.L.cond.main.15:
+  mov r12, r11
+  cmp r12, 4
+  jl .L.begin.main.15
+  lea r12, [rbp-272]
+  mov rax, r12
+  mov rdi, r11
+  mov [rax], rdi
+  lea r11, [rbp-276]
+  add r11, 1
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  lea rbx, [rbp-276]
+  add rbx, 2
+  movsx rax, byte ptr [rbx]
+  mov rbx, rax
+  add r11, rbx
+  lea rbx, [rbp-276]
+  add rbx, 3
+  movsx rax, byte ptr [rbx]
+  mov rbx, rax
+  add r11, rbx
+  mov rbx, offset .L.data.188
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 9
+  lea r11, [rbp-296]
+  lea rbx, [rbp-304]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  lea r11, [rbp-304]
+  mov rbx, 0
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  lea r11, [rbp-288]
+  jmp .L.cond.main.16
+.L.begin.main.16:
+  mov rbx, [rbp-304]
+  lea rbx, [r11+rbx*8]
+  mov r12, [rbp-296]
+  mov r12, [r12]
+  imul r12, 3
+  mov rax, rbx
+  mov rdi, r12
+  mov [rax], rdi
+  lea rbx, [rbp-304]
+  mov r12, [rbp-304]
+  add r12, 1
+  mov rax, rbx
+  mov rdi, r12
+  mov [rax], rdi
+.L.cond.main.16:
+  mov rax, [rbp-304]
+  mov rbx, rax
+  cmp rbx, 3
+  jl .L.begin.main.16
+  lea r11, [rbp-288]
+  add r11, 16
+  mov r11, [r11]
+  mov rbx, [rbp-304]
+  add r11, rbx
+  mov rbx, offset .L.data.189
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rax, 46
+  mov [rbp-608], rax
+  lea r11, [rbp-536]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rax, [rbp-536]
+  mov rbx, rax
+  mov r11, rbx
+  lea rbx, [rbp-528]
+  lea r12, [rbp-440]
+  jmp .L.cond.main.17
+.L.begin.main.17:
+  mov r13, r11
+  lea r13, [rbx+r13*8]
+  mov r14, r11
+  mov rax, r13
+  mov rdi, r14
+  mov [rax], rdi
+  mov r13, r11
+  lea r13, [r12+r13*8]
+  mov r14, r11
+  shl r14, 1
+  mov rax, r13
+  mov rdi, r14
+  mov [rax], rdi
+  mov r13, r11
+  mov rax, r13
+  add rax, 1
+  mov r13, rax
+  mov r11, r13
+.L.cond.main.17:
+  mov r13, r11
+  cmp r13, 11
+  jl .L.begin.main.17
+  lea r13, [rbp-536]
+  mov rax, r13
+  mov rdi, r11
+  mov [rax], rdi
+  lea r11, [rbp-536]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rbx, [rbp-536]
+  mov r11, rbx
+  lea rbx, [rbp-352]
+  lea r12, [rbp-440]
+  mov r13, 11
+  lea r14, [rbp-528]
+  mov rax, r11
+  mov rdi, r13
+  sub rdi, 1
+  cmp rax, rdi
+  jge .L.vend.main.18
+.L.vbegin.main.18:
+  movdqu xmm1, [r12+rax*8]
+  movdqu xmm2, [r14+rax*8]
+  psubq xmm1, xmm2
+  movdqu xmm2, [r12+rax*8]
+  paddq xmm1, xmm2
+  movdqu [rbx+rax*8], xmm1
+  add rax, 2
+  cmp rax, rdi
+  jl .L.vbegin.main.18
+.L.vend.main.18:
+  mov r11, rax
+  jmp .L.cond.main.18
+.L.begin.main.18:
+  mov r13, r11
+  lea r13, [rbx+r13*8]
+  mov r14, r11
+  mov r14, [r12+r14*8]
+  lea r15, [rbp-528]
+  mov r10, r11
+  mov r10, [r15+r10*8]
+  mov rax, r14
+  sub rax, r10
+  mov r10, rax
+  mov r14, r11
+  mov r14, [r12+r14*8]
+  add r10, r14
+  mov rax, r13
+  mov rdi, r10
+  mov [rax], rdi
+  mov r10, r11
+  mov rax, r10
+  add rax, 1
+  mov r10, rax
+  mov r11, r10
+.L.cond.main.18:
+  mov r10, r11
+  cmp r10, 11
+  jl .L.begin.main.18
+  lea r10, [rbp-536]
+  mov rax, r10
+  mov rdi, r11
+  mov [rax], rdi
+  lea r10, [rbp-352]
+  add r10, 80
+  mov r10, [r10]
+  lea r11, [rbp-352]
+  add r11, 24
+  mov r11, [r11]
+  add r10, r11
+  lea r11, [rbp-528]
+  add r11, 16
+  mov r11, [r11]
+  sub r10, r11
+  mov r11, [rbp-536]
+  add r10, r11
+  sub r10, 2
+  mov r11, offset .L.data.190
+  mov rdi, [rbp-608]
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, -56
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rax, [rbp-272]
+  mov rbx, rax
+  mov r11, rbx
+  lea rbx, [rbp-346]
+  lea r12, [rbp-309]
+  jmp .L.cond.main.19
+.L.begin.main.19:
+  mov r13, r11
+  lea r13, [rbx+r13*1]
+  mov rax, r13
+  mov rdi, 100
+  mov [rax], dil
+  mov r13, r11
+  lea r13, [r12+r13*1]
+  mov r14, r11
+  mov rax, r13
+  mov rdi, r14
+  mov [rax], dil
+  mov r13, r11
+  mov rax, r13
+  add rax, 1
+  mov r13, rax
+  mov r11, r13
+.L.cond.main.19:
+  mov r13, r11
+  cmp r13, 37
+  jl .L.begin.main.19
+  lea r13, [rbp-272]
+  mov rax, r13
+  mov rdi, r11
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 1
+  mov [rax], rdi
+  mov rbx, [rbp-272]
+  mov r11, rbx
+  lea rbx, [rbp-309]
+  lea r12, [rbp-346]
+  mov r13, 37
+  mov rax, r11
+  mov rdi, r13
+  sub rdi, 15
+  cmp rax, rdi
+  jge .L.vend.main.20
+.L.vbegin.main.20:
+  movdqu xmm1, [r12+rax*1]
+  movdqu xmm2, [r12+rax*1]
+  paddb xmm1, xmm2
+  movdqu [rbx+rax*1], xmm1
+  add rax, 16
+  cmp rax, rdi
+  jl .L.vbegin.main.20
+.L.vend.main.20:
+  mov r11, rax
+  jmp .L.cond.main.20
+.L.begin.main.20:
+  mov r13, r11
+  lea r13, [rbx+r13*1]
+  mov r14, r11
+  movsx rax, byte ptr [r12+r14*1]
+  mov r14, rax
+  mov r15, r11
+  movsx rax, byte ptr [r12+r15*1]
+  mov r15, rax
+  add r14, r15
+  mov rax, r13
+  mov rdi, r14
+  mov [rax], dil
+  mov r13, r11
+  mov rax, r13
+  add rax, 1
+  mov r13, rax
+  mov r11, r13
+.L.cond.main.20:
+  mov r13, r11
+  cmp r13, 37
+  jl .L.begin.main.20
+  lea r13, [rbp-272]
+  mov rax, r13
+  mov rdi, r11
+  mov [rax], rdi
+  lea r11, [rbp-309]
+  add r11, 36
+  movsx rax, byte ptr [r11]
+  mov r11, rax
+  movsx rax, byte ptr [rbp-309]
+  mov rbx, rax
+  add r11, rbx
+  mov rbx, offset .L.data.191
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 87
+  lea r11, [rbp-392]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rax, [rbp-392]
+  mov rbx, rax
+  mov r11, rbx
+  lea rbx, [rbp-368]
+  jmp .L.cond.main.21
+.L.begin.main.21:
+  mov r12, r11
+  lea r12, [rbx+r12*8]
+  mov r13, r11
+  mov rax, r12
+  mov rdi, r13
+  mov [rax], rdi
+  mov r12, r11
+  mov rax, r12
+  add rax, 1
+  mov r12, rax
+  mov r11, r12
+.L.cond.main.21:
+  mov r12, r11
+  cmp r12, 13
+  jl .L.begin.main.21
+  lea r12, [rbp-392]
+  mov rax, r12
+  mov rdi, r11
+  mov [rax], rdi
+  lea r11, [rbp-384]
+  mov rax, r11
+  mov rdi, 13
+  mov [rax], rdi
+  lea r11, [rbp-376]
+  mov rax, r11
+  mov rdi, 10
+  mov [rax], rdi
+  lea r11, [rbp-392]
+  mov rax, r11
+  mov rdi, 2
+  mov [rax], rdi
+  mov rbx, [rbp-392]
+  mov r11, rbx
+  lea rbx, [rbp-368]
+  mov r12, [rbp-384]
+  mov rax, r11
+  mov rdi, r12
+  sub rdi, 1
+  pxor xmm0, xmm0
+  cmp rax, rdi
+  jge .L.vend.main.22
+.L.vbegin.main.22:
+  movdqu xmm1, [rbx+rax*8]
+  paddq xmm0, xmm1
+  add rax, 2
+  cmp rax, rdi
+  jl .L.vbegin.main.22
+.L.vend.main.22:
+  pshufd xmm1, xmm0, 78
+  paddq xmm0, xmm1
+  movq rdi, xmm0
+  mov r11, rax
+  mov r12, rdi
+  lea r13, [rbp-376]
+  mov r14, [r13]
+  mov rax, r14
+  add rax, r12
+  mov r12, rax
+  mov rax, r13
+  mov rdi, r12
+  mov [rax], rdi
+  jmp .L.cond.main.22
+.L.begin.main.22:
+  lea r12, [rbp-376]
+  mov r13, [rbp-376]
+  mov r14, r11
+  mov r14, [rbx+r14*8]
+  add r13, r14
+  mov rax, r12
+  mov rdi, r13
+  mov [rax], rdi
+  mov r12, r11
+  mov rax, r12
+  add rax, 1
+  mov r12, rax
+  mov r11, r12
+.L.cond.main.22:
+  mov r12, r11
+  mov rax, [rbp-384]
+  mov r13, rax
+  cmp r12, r13
+  jl .L.begin.main.22
+  lea r12, [rbp-392]
+  mov rax, r12
+  mov rdi, r11
+  mov [rax], rdi
+  mov r11, [rbp-376]
+  mov rbx, offset .L.data.192
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 45
+  lea r11, [rbp-368]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rax, [rbp-368]
+  mov rbx, rax
+  mov r11, rbx
+  lea rbx, [rbp-352]
+  jmp .L.cond.main.23
+.L.begin.main.23:
+  mov r12, r11
+  lea r12, [rbx+r12*8]
+  mov r13, r11
+  mov rax, r12
+  mov rdi, r13
+  mov [rax], rdi
+  mov r12, r11
+  mov rax, r12
+  add rax, 1
+  mov r12, rax
+  mov r11, r12
+.L.cond.main.23:
+  mov r12, r11
+  cmp r12, 10
+  jl .L.begin.main.23
+  lea r12, [rbp-368]
+  mov rax, r12
+  mov rdi, r11
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  lea rbx, [rbp-352]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  lea r11, [rbp-360]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  lea r11, [rbp-368]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rbx, [rbp-368]
+  mov r11, rbx
+  mov rbx, 10
+  mov r12, [rbp-272]
+  mov rax, r11
+  mov rdi, rbx
+  sub rdi, 1
+  pxor xmm0, xmm0
+  cmp rax, rdi
+  jge .L.vend.main.24
+.L.vbegin.main.24:
+  movdqu xmm1, [r12+rax*8]
+  paddq xmm0, xmm1
+  add rax, 2
+  cmp rax, rdi
+  jl .L.vbegin.main.24
+.L.vend.main.24:
+  pshufd xmm1, xmm0, 78
+  paddq xmm0, xmm1
+  movq rdi, xmm0
+  mov r11, rax
+  mov rbx, rdi
+  lea r12, [rbp-360]
+  mov r13, [r12]
+  mov rax, r13
+  add rax, rbx
+  mov rbx, rax
+  mov rax, r12
+  mov rdi, rbx
+  mov [rax], rdi
+  jmp .L.cond.main.24
+.L.begin.main.24:
+  lea rbx, [rbp-360]
+  mov r12, [rbp-272]
+  mov r13, r11
+  mov r12, [r12+r13*8]
+  mov r13, [rbp-360]
+  add r12, r13
+  mov rax, rbx
+  mov rdi, r12
+  mov [rax], rdi
+  mov rbx, r11
+  mov rax, rbx
+  add rax, 1
+  mov rbx, rax
+  mov r11, rbx
+.L.cond.main.24:
+  mov rbx, r11
+  cmp rbx, 10
+  jl .L.begin.main.24
+  lea rbx, [rbp-368]
+  mov rax, rbx
+  mov rdi, r11
+  mov [rax], rdi
+  mov r11, [rbp-360]
+  mov rbx, offset .L.data.193
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 22
+  lea r11, [rbp-304]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rax, [rbp-304]
+  mov rbx, rax
+  mov r11, rbx
+  mov rbx, offset g2
+  lea r12, [rbp-296]
+  jmp .L.cond.main.25
+.L.begin.main.25:
+  mov r13, r11
+  lea r13, [rbx+r13*8]
+  mov r14, r11
+  imul r14, 3
+  mov rax, r13
+  mov rdi, r14
+  mov [rax], rdi
+  mov r13, r11
+  lea r13, [r12+r13*8]
+  mov r14, r11
+  mov rax, r13
+  mov rdi, r14
+  mov [rax], rdi
+  mov r13, r11
+  mov rax, r13
+  add rax, 1
+  mov r13, rax
+  mov r11, r13
+.L.cond.main.25:
+  mov r13, r11
+  cmp r13, 4
+  jl .L.begin.main.25
+  lea r13, [rbp-304]
+  mov rax, r13
+  mov rdi, r11
+  mov [rax], rdi
+  lea r11, [rbp-304]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  mov rbx, [rbp-304]
+  mov r11, rbx
+  mov rbx, offset g2
+  lea r12, [rbp-296]
+  mov r13, 4
+  mov rax, r11
+  mov rdi, r13
+  sub rdi, 1
+  cmp rax, rdi
+  jge .L.vend.main.26
+.L.vbegin.main.26:
+  movdqu xmm1, [rbx+rax*8]
+  movdqu xmm2, [r12+rax*8]
+  psubq xmm1, xmm2
+  movdqu [rbx+rax*8], xmm1
+  add rax, 2
+  cmp rax, rdi
+  jl .L.vbegin.main.26
+.L.vend.main.26:
+  mov r11, rax
+  jmp .L.cond.main.26
+.L.begin.main.26:
+  mov r13, r11
+  lea r13, [rbx+r13*8]
+  mov r14, r11
+  mov r14, [rbx+r14*8]
+  mov r15, r11
+  mov r15, [r12+r15*8]
+  sub r14, r15
+  mov rax, r13
+  mov rdi, r14
+  mov [rax], rdi
+  mov r13, r11
+  mov rax, r13
+  add rax, 1
+  mov r13, rax
+  mov r11, r13
+.L.cond.main.26:
+  mov r13, r11
+  cmp r13, 4
+  jl .L.begin.main.26
+  lea r13, [rbp-304]
+  mov rax, r13
+  mov rdi, r11
+  mov [rax], rdi
+  mov r11, offset g2
+  add r11, 24
+  mov r11, [r11]
+  mov rbx, offset g2
+  add rbx, 16
+  mov rbx, [rbx]
+  add r11, rbx
+  mov rbx, [rbp-304]
+  add r11, rbx
+  lea rbx, [rbp-296]
+  add rbx, 24
+  mov rbx, [rbx]
+  add r11, rbx
+  lea rbx, [rbp-296]
+  add rbx, 24
+  mov rbx, [rbx]
+  add r11, rbx
+  lea rbx, [rbp-296]
+  add rbx, 16
+  mov rbx, [rbx]
+  add r11, rbx
+  mov rbx, offset .L.data.194
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, 50005000
+  mov rdi, 10000
+  mov rsi, 0
+  mov rax, 0
+  call sum_to
+  mov r10, rax
+  mov r11, offset .L.data.195
+  mov rdi, rbx
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, 34512
+  mov r12, 2
+  mov r13, 3
+  mov r14, 4
+  mov r15, 5
+  mov rdi, 7
+  mov rsi, 1
+  mov rdx, r12
+  mov rcx, r13
+  mov r8, r14
+  mov r9, r15
+  mov rax, 0
+  call rot5
+  mov r10, rax
+  mov r11, offset .L.data.196
+  mov rdi, rbx
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, 1
+  mov rdi, 10000
+  mov rax, 0
+  call is_even
+  mov r10, rax
+  mov r11, offset .L.data.197
+  mov rdi, rbx
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, 1
+  mov rdi, 10001
+  mov rax, 0
+  call is_odd
+  mov r10, rax
+  mov r11, offset .L.data.198
+  mov rdi, rbx
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, 4
+  mov rdi, 3
+  mov rax, 0
+  call via_ptr
+  mov r10, rax
+  mov r11, offset .L.data.199
+  mov rdi, rbx
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, 6
+  mov rdi, 5
+  mov rax, 0
+  call pick
+  mov r10, rax
+  mov r11, offset .L.data.200
+  mov rdi, rbx
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, 5
+  mov rdi, 5
+  mov rax, 0
+  call count_up
+  mov r10, rax
+  mov r11, offset .L.data.201
+  mov rdi, rbx
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, 6
+  mov rdi, 3
+  mov rax, 0
+  call count_const
+  mov r10, rax
+  mov r11, offset .L.data.202
+  mov rdi, rbx
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, 1
+  mov rdi, 4
+  mov rax, 0
+  call both_return
+  mov r10, rax
+  mov r11, offset .L.data.203
+  mov rdi, rbx
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rbx, 2
+  mov rdi, 0
+  mov rax, 0
+  call both_return
+  mov r10, rax
+  mov r11, offset .L.data.204
+  mov rdi, rbx
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 11
+  lea r11, [rbp-296]
+  mov rax, r11
+  mov rdi, 5
+  mov [rax], rdi
+  lea r11, [rbp-296]
+  add r11, 8
+  mov rax, r11
+  mov rdi, 6
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  lea rbx, [rbp-296]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov r11, [r11]
+  mov rbx, [rbp-272]
+  add rbx, 8
+  mov rbx, [rbx]
+  add r11, rbx
+  mov rbx, offset .L.data.205
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r11, offset g2
+  mov rax, r11
+  mov rdi, 7
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rbx, offset g2
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov r11, [r11]
+  mov rbx, offset .L.data.206
+  mov rdi, 7
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-320]
+  add r11, 24
+  add r11, 16
+  mov rax, r11
+  mov rdi, 9
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  lea rbx, [rbp-320]
+  add rbx, 24
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  add r11, 16
+  mov r11, [r11]
+  mov rbx, offset .L.data.207
+  mov rdi, 9
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, 1
+  lea r11, [rbp-280]
+  mov rax, r11
+  mov rdi, 0
+  mov [rax], rdi
+  lea r11, [rbp-272]
+  mov rbx, [rbp-280]
+  mov r12, 3000000000
+  lea rbx, [rbx+r12*1]
+  mov rax, r11
+  mov rdi, rbx
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, [rbp-280]
+  sub r11, rbx
+  mov rax, r11
+  mov rdi, 1
+  cqo
+  idiv rdi
+  mov r11, rax
+  mov rbx, 3000000000
+  mov rax, r11
+  cmp rax, rbx
+  sete al
+  movzb rax, al
+  mov r11, rax
+  mov rbx, offset .L.data.208
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 3
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.209
+  mov rdi, 3
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r11, [rbp-272]
+  mov rax, r11
+  mov rdi, 7
+  mov [rax], rdi
+  mov r11, [rbp-272]
+  mov rbx, offset .L.data.210
+  mov rdi, 7
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.211
+  mov rdi, r10
+  mov rax, 0
+  call printf
+  mov r10, rax
+  mov rax, 0
+  jmp .L.return.main
+.L.return.main:
+  mov rbx, [rbp-544]
+  mov r12, [rbp-552]
+  mov r13, [rbp-560]
+  mov r14, [rbp-568]
+  mov r15, [rbp-576]
+  mov rsp, rbp
+  pop rbp
+  ret
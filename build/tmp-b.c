@@ -0,0 +1,1129 @@
+// -*- c -*-
+
+// This is a line comment.
+
+/*
+ * This is a block comment.
+ */
+
+int g1;
+int g2[4];
+
+int assert(int expected, int actual, char *code) {
+  if (expected == actual) {
+    printf("%s => %d\n", code, actual);
+  } else {
+    printf("%s => %d expected but got %d\n", code, expected, actual);
+    exit(1);
+  }
+}
+
+int ret3() {
+  return 3;
+  return 5;
+}
+
+int add2(int x, int y) { return x + y; }
+
+int sub2(int x, int y) { return x - y; }
+
+int add6(int a, int b, int c, int d, int e, int f) {
+  return a + b + c + d + e + f;
+}
+
+int addx(int *x, int y) { return *x + y; }
+
+int sub_char(char a, char b, char c) { return a - b - c; }
+
+int clamp_add(int x, int y) {
+  int z;
+  z = x + y;
+  if (z < 0) z = 0;
+  return z;
+}
+
+int fib(int x) {
+  if (x <= 1) return 1;
+  return fib(x - 1) + fib(x - 2);
+}
+
+int sum_to(int n, int acc) {
+  if (n == 0) return acc;
+  return sum_to(n - 1, acc + n);
+}
+
+int rot5(int n, int a, int b, int c, int d, int e) {
+  if (n == 0) return a * 10000 + b * 1000 + c * 100 + d * 10 + e;
+  return rot5(n - 1, b, c, d, e, a);
+}
+
+int is_even(int n) {
+  if (n == 0) return 1;
+  return is_odd(n - 1);
+}
+
+int is_odd(int n) {
+  if (n == 0) return 0;
+  return is_even(n - 1);
+}
+
+int via_ptr(int x) {
+  int y;
+  y = x;
+  return addx(&y, 1);
+}
+
+int pick(int x) {
+  int unused[16];
+  if (0) {
+    unused[0] = x;
+    return 1;
+  } else if (1)
+    x = x + 1;
+  while (0) x = 100;
+  for (;;) return x;
+  return 7;
+}
+
+int count_up(int n) {
+  int i;
+  i = 0;
+  while (1) {
+    i = i + 1;
+    if (i == n) return i;
+  }
+}
+
+int count_const(int n) {
+  int i;
+  i = 0;
+  while (2 > 1) {
+    i = i + 1;
+    if (i == n) return i * 2;
+  }
+}
+
+int both_return(int x) {
+  if (x) {
+    return 1;
+  } else {
+    return 2;
+  }
+  return 3;
+}
+
+int main() {
+  assert(8, ({
+           int a = 3;
+           int z = 5;
+           a + z;
+         }),
+         "int a=3; int z=5; a+z;");
+
+  assert(0, 0, "0");
+  assert(42, 42, "42");
+  assert(5, 5, "0");
+  assert(41, 12 + 34 - 5, " 12 + 34 - 5 ");
+  assert(5, 5, "0");
+  assert(15, 5 * (9 - 6), "5*(9-6)");
+  assert(4, (3 + 5) / 2, "(3+5)/2");
+  assert(-10, -10, "0");
+  assert(10, - - 10, "- -10");
+  assert(10, - - +10, "- - +10");
+
+  assert(0, 0 == 1, "0==1");
+  assert(1, 42 == 42, "42==42");
+  assert(1, 0 != 1, "0!=1");
+  assert(0, 42 != 42, "42!=42");
+
+  assert(1, 0 < 1, "0<1");
+  assert(0, 1 < 1, "1<1");
+  assert(0, 2 < 1, "2<1");
+  assert(1, 0 <= 1, "0<=1");
+  assert(1, 1 <= 1, "1<=1");
+  assert(0, 2 <= 1, "2<=1");
+
+  assert(1, 1 > 0, "1>0");
+  assert(0, 1 > 1, "1>1");
+  assert(0, 1 > 2, "1>2");
+  assert(1, 1 >= 0, "1>=0");
+  assert(1, 1 >= 1, "1>=1");
+  assert(0, 1 >= 2, "1>=2");
+
+  assert(3, ({
+           int a;
+           a = 3;
+           a;
+         }),
+         "int a; a=3; a;");
+  assert(8, ({
+           int a;
+           int z;
+           a = 3;
+           z = 5;
+           a + z;
+         }),
+         "int a; int z; a=3; z=5; a+z;");
+  assert(3, ({
+           int a = 3;
+           a;
+         }),
+         "int a=3; a;");
+  assert(8, ({
+           int a = 3;
+           int z = 5;
+           a + z;
+         }),
+         "int a=3; int z=5; a+z;");
+
+  assert(3, ({
+           int foo = 3;
+           foo;
+         }),
+         "int foo=3; foo;");
+  assert(8, ({
+           int foo123 = 3;
+           int bar = 5;
+           foo123 + bar;
+         }),
+         "int foo123=3; int bar=5; foo123+bar;");
+
+  assert(3, ret3(), "ret3();");
+
+  assert(3, ({
+           int x = 0;
+           if (0)
+             x = 2;
+           else
+             x = 3;
+           x;
+         }),
+         "int x=0; if (0) x=2; else x=3; x;");
+  assert(3, ({
+           int x = 0;
+           if (1 - 1)
+             x = 2;
+           else
+             x = 3;
+           x;
+         }),
+         "int x=0; if (1-1) x=2; else x=3; x;");
+  assert(2, ({
+           int x = 0;
+           if (1)
+             x = 2;
+           else
+             x = 3;
+           x;
+         }),
+         "int x=0; if (1) x=2; else x=3; x;");
+  assert(2, ({
+           int x = 0;
+           if (2 - 1)
+             x = 2;
+           else
+             x = 3;
+           x;
+         }),
+         "int x=0; if (2-1) x=2; else x=3; x;");
+
+  assert(3, ({
+           1;
+           { 2; }
+           3;
+         }),
+         "1; {2;} 3;");
+  assert(10, ({
+           int i = 0;
+           i = 0;
+           while (i < 10) i = i + 1;
+           i;
+         }),
+         "int i=0; i=0; while(i<10) i=i+1; i;");
+  assert(55, ({
+           int i = 0;
+           int j = 0;
+           while (i <= 10) {
+             j = i + j;
+             i = i + 1;
+           }
+           j;
+         }),
+         "int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} j;");
+  assert(55, ({
+           int i = 0;
+           int j = 0;
+           for (i = 0; i <= 10; i = i + 1) j = i + j;
+           j;
+         }),
+         "int i=0; int j=0; for (i=0; i<=10; i=i+1) j=i+j; j;");
+
+  assert(55, 1 + (2 + (3 + (4 + (5 + (6 + (7 + (8 + (9 + 10)))))))),
+         "1+(2+(3+(4+(5+(6+(7+(8+(9+10))))))))");
+  assert(36, 1 + (2 + (3 + (4 + (5 + (6 + (7 + add2(3, 5))))))),
+         "1+(2+(3+(4+(5+(6+(7+add2(3,5)))))))");
+
+  assert(24, ({
+           int x = 3;
+           x * 8;
+         }),
+         "int x=3; x*8;");
+  assert(-3, ({
+           int x = 3;
+           -x;
+         }),
+         "int x=3; -x;");
+  assert(-7, ({
+           int x = 4;
+           int y = 3;
+           y = 0 - (x + y);
+           y;
+         }),
+         "int x=4; int y=3; y=0-(x+y); y;");
+  assert(-5, ({
+           int x = 3;
+           x = 5;
+           x = 0 - x;
+           x;
+         }),
+         "int x=3; x=5; x=0-x; x;");
+  assert(5, ({
+           int x = 5;
+           1 * x + 0 - 0;
+         }),
+         "int x=5; 1*x+0-0;");
+  assert(6, ({
+           int x[4];
+           x[3] = 6;
+           *(x + 1 + 2);
+         }),
+         "int x[4]; x[3]=6; *(x+1+2);");
+
+  assert(8, add2(3, 5), "add(3, 5)");
+  assert(2, sub2(5, 3), "sub(5, 3)");
+  assert(21, add6(1, 2, 3, 4, 5, 6), "add6(1,2,3,4,5,6)");
+  assert(18, add6(1, 2, 3, 4, 5, sub2(9, add6(1, 1, 1, 1, 1, 1))), "add6(1,2,3,4,5,sub2(9,add6(1,1,1,1,1,1)))");
+  assert(55, fib(9), "fib(9)");
+  assert(7, clamp_add(3, 4), "clamp_add(3, 4)");
+  assert(0, clamp_add(3, -4), "clamp_add(3, -4)");
+  assert(5, ({ int x=2; clamp_add(x, clamp_add(x, 1)); }), "int x=2; clamp_add(x, clamp_add(x, 1));");
+
+  assert(3, ({
+           int x = 3;
+           *&x;
+         }),
+         "int x=3; *&x;");
+  assert(3, ({
+           int x = 3;
+           int *y = &x;
+           int **z = &y;
+           **z;
+         }),
+         "int x=3; int *y=&x; int **z=&y; **z;");
+  assert(5, ({
+           int x = 3;
+           int y = 5;
+           *(&x + 1);
+         }),
+         "int x=3; int y=5; *(&x+1);");
+  assert(5, ({
+           int x = 3;
+           int y = 5;
+           *(1 + &x);
+         }),
+         "int x=3; int y=5; *(1+&x);");
+  assert(3, ({
+           int x = 3;
+           int y = 5;
+           *(&y - 1);
+         }),
+         "int x=3; int y=5; *(&y-1);");
+  assert(2, ({
+           int x = 3;
+           (&x + 2) - &x;
+         }),
+         "int x=3; (&x+2)-&x;");
+
+  assert(5, ({
+           int x = 3;
+           int y = 5;
+           int *z = &x;
+           *(z + 1);
+         }),
+         "int x=3; int y=5; int *z=&x; *(z+1);");
+  assert(3, ({
+           int x = 3;
+           int y = 5;
+           int *z = &y;
+           *(z - 1);
+         }),
+         "int x=3; int y=5; int *z=&y; *(z-1);");
+  assert(5, ({
+           int x = 3;
+           int *y = &x;
+           *y = 5;
+           x;
+         }),
+         "int x=3; int *y=&x; *y=5; x;");
+  assert(7, ({
+           int x = 3;
+           int y = 5;
+           *(&x + 1) = 7;
+           y;
+         }),
+         "int x=3; int y=5; *(&x+1)=7; y;");
+  assert(7, ({
+           int x = 3;
+           int y = 5;
+           *(&y - 1) = 7;
+           x;
+         }),
+         "int x=3; int y=5; *(&y-1)=7; x;");
+  assert(8, ({
+           int x = 3;
+           int y = 5;
+           addx(&x, y);
+         }),
+         "int x=3; int y=5; addx(&x, y);");
+
+  assert(3, ({
+           int x[2];
+           int *y = &x;
+           *y = 3;
+           *x;
+         }),
+         "int x[2]; int *y=&x; *y=3; *x;");
+
+  assert(3, ({
+           int x[3];
+           *x = 3;
+           *(x + 1) = 4;
+           *(x + 2) = 5;
+           *x;
+         }),
+         "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *x;");
+  assert(4, ({
+           int x[3];
+           *x = 3;
+           *(x + 1) = 4;
+           *(x + 2) = 5;
+           *(x + 1);
+         }),
+         "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+1);");
+  assert(5, ({
+           int x[3];
+           *x = 3;
+           *(x + 1) = 4;
+           *(x + 2) = 5;
+           *(x + 2);
+         }),
+         "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+2);");
+
+  assert(0, ({
+           int x[2][3];
+           int *y = x;
+           *y = 0;
+           **x;
+         }),
+         "int x[2][3]; int *y=x; *y=0; **x;");
+  assert(1, ({
+           int x[2][3];
+           int *y = x;
+           *(y + 1) = 1;
+           *(*x + 1);
+         }),
+         "int x[2][3]; int *y=x; *(y+1)=1; *(*x+1);");
+  assert(2, ({
+           int x[2][3];
+           int *y = x;
+           *(y + 2) = 2;
+           *(*x + 2);
+         }),
+         "int x[2][3]; int *y=x; *(y+2)=2; *(*x+2);");
+  assert(3, ({
+           int x[2][3];
+           int *y = x;
+           *(y + 3) = 3;
+           **(x + 1);
+         }),
+         "int x[2][3]; int *y=x; *(y+3)=3; **(x+1);");
+  assert(4, ({
+           int x[2][3];
+           int *y = x;
+           *(y + 4) = 4;
+           *(*(x + 1) + 1);
+         }),
+         "int x[2][3]; int *y=x; *(y+4)=4; *(*(x+1)+1);");
+  assert(5, ({
+           int x[2][3];
+           int *y = x;
+           *(y + 5) = 5;
+           *(*(x + 1) + 2);
+         }),
+         "int x[2][3]; int *y=x; *(y+5)=5; *(*(x+1)+2);");
+  assert(6, ({
+           int x[2][3];
+           int *y = x;
+           *(y + 6) = 6;
+           **(x + 2);
+         }),
+         "int x[2][3]; int *y=x; *(y+6)=6; **(x+2);");
+
+  assert(3, ({
+           int x[3];
+           *x = 3;
+           x[1] = 4;
+           x[2] = 5;
+           *x;
+         }),
+         "int x[3]; *x=3; x[1]=4; x[2]=5; *x;");
+  assert(4, ({
+           int x[3];
+           *x = 3;
+           x[1] = 4;
+           x[2] = 5;
+           *(x + 1);
+         }),
+         "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+1);");
+  assert(5, ({
+           int x[3];
+           *x = 3;
+           x[1] = 4;
+           x[2] = 5;
+           *(x + 2);
+         }),
+         "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);");
+  assert(5, ({
+           int x[3];
+           *x = 3;
+           x[1] = 4;
+           x[2] = 5;
+           *(x + 2);
+         }),
+         "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);");
+  assert(5, ({
+           int x[3];
+           *x = 3;
+           x[1] = 4;
+           2 [x] = 5;
+           *(x + 2);
+         }),
+         "int x[3]; *x=3; x[1]=4; 2[x]=5; *(x+2);");
+
+  assert(0, ({
+           int x[2][3];
+           int *y = x;
+           y[0] = 0;
+           x[0][0];
+         }),
+         "int x[2][3]; int *y=x; y[0]=0; x[0][0];");
+  assert(1, ({
+           int x[2][3];
+           int *y = x;
+           y[1] = 1;
+           x[0][1];
+         }),
+         "int x[2][3]; int *y=x; y[1]=1; x[0][1];");
+  assert(2, ({
+           int x[2][3];
+           int *y = x;
+           y[2] = 2;
+           x[0][2];
+         }),
+         "int x[2][3]; int *y=x; y[2]=2; x[0][2];");
+  assert(3, ({
+           int x[2][3];
+           int *y = x;
+           y[3] = 3;
+           x[1][0];
+         }),
+         "int x[2][3]; int *y=x; y[3]=3; x[1][0];");
+  assert(4, ({
+           int x[2][3];
+           int *y = x;
+           y[4] = 4;
+           x[1][1];
+         }),
+         "int x[2][3]; int *y=x; y[4]=4; x[1][1];");
+  assert(5, ({
+           int x[2][3];
+           int *y = x;
+           y[5] = 5;
+           x[1][2];
+         }),
+         "int x[2][3]; int *y=x; y[5]=5; x[1][2];");
+  assert(6, ({
+           int x[2][3];
+           int *y = x;
+           y[6] = 6;
+           x[2][0];
+         }),
+         "int x[2][3]; int *y=x; y[6]=6; x[2][0];");
+
+  assert(8, ({
+           int x;
+           sizeof(x);
+         }),
+         "int x; sizeof(x);");
+  assert(8, ({
+           int x;
+           sizeof x;
+         }),
+         "int x; sizeof x;");
+  assert(8, ({
+           int *x;
+           sizeof(x);
+         }),
+         "int *x; sizeof(x);");
+  assert(32, ({
+           int x[4];
+           sizeof(x);
+         }),
+         "int x[4]; sizeof(x);");
+  assert(96, ({
+           int x[3][4];
+           sizeof(x);
+         }),
+         "int x[3][4]; sizeof(x);");
+  assert(32, ({
+           int x[3][4];
+           sizeof(*x);
+         }),
+         "int x[3][4]; sizeof(*x);");
+  assert(8, ({
+           int x[3][4];
+           sizeof(**x);
+         }),
+         "int x[3][4]; sizeof(**x);");
+  assert(9, ({
+           int x[3][4];
+           sizeof(**x) + 1;
+         }),
+         "int x[3][4]; sizeof(**x) + 1;");
+  assert(9, ({
+           int x[3][4];
+           sizeof **x + 1;
+         }),
+         "int x[3][4]; sizeof **x + 1;");
+  assert(8, ({
+           int x[3][4];
+           sizeof(**x + 1);
+         }),
+         "int x[3][4]; sizeof(**x + 1);");
+
+  assert(0, g1, "g1");
+  g1 = 3;
+  assert(3, g1, "g1");
+
+  g2[0] = 0;
+  g2[1] = 1;
+  g2[2] = 2;
+  g2[3] = 3;
+  assert(0, g2[0], "g2[0]");
+  assert(1, g2[1], "g2[1]");
+  assert(2, g2[2], "g2[2]");
+  assert(3, g2[3], "g2[3]");
+
+  assert(2, ({
+           int x = 2;
+           {
+             int x = 3;
+           }
+           x;
+         }),
+         "int x=2; { int x=3; } x;");
+  assert(7, ({
+           int g1 = 7;
+           g1;
+         }),
+         "int g1=7; g1;");
+  assert(3, g1, "g1");
+
+  assert(8, sizeof(g1), "sizeof(g1)");
+  assert(32, sizeof(g2), "sizeof(g2)");
+
+  assert(1, ({
+           char x = 1;
+           x;
+         }),
+         "char x=1; x;");
+  assert(1, ({
+           char x = 1;
+           char y = 2;
+           x;
+         }),
+         "char x=1; char y=2; x;");
+  assert(2, ({
+           char x = 1;
+           char y = 2;
+           y;
+         }),
+         "char x=1; char y=2; y;");
+
+  assert(1, ({
+           char x;
+           sizeof(x);
+         }),
+         "char x; sizeof(x);");
+  assert(10, ({
+           char x[10];
+           sizeof(x);
+         }),
+         "char x[10]; sizeof(x);");
+  assert(1, sub_char(7, 3, 3), "sub_char(7, 3, 3)");
+
+  assert(97, "abc"[0], "\"abc\"[0]");
+  assert(98, "abc"[1], "\"abc\"[1]");
+  assert(99, "abc"[2], "\"abc\"[2]");
+  assert(0, "abc"[3], "\"abc\"[3]");
+  assert(4, sizeof("abc"), "sizeof(\"abc\")");
+
+  assert(7, "\a"[0], "\"\\a\"[0]");
+  assert(8, "\b"[0], "\"\\b\"[0]");
+  assert(9, "\t"[0], "\"\\t\"[0]");
+  assert(10, "\n"[0], "\"\\n\"[0]");
+  assert(11, "\v"[0], "\"\\v\"[0]");
+  assert(12, "\f"[0], "\"\\f\"[0]");
+  assert(13, "\r"[0], "\"\\r\"[0]");
+  assert(27, "\e"[0], "\"\\e\"[0]");
+  assert(0, "\0"[0], "\"\\0\"[0]");
+
+  assert(106, "\j"[0], "\"\\j\"[0]");
+  assert(107, "\k"[0], "\"\\k\"[0]");
+  assert(108, "\l"[0], "\"\\l\"[0]");
+
+  assert(2, ({
+           int x = 2;
+           { int x = 3; }
+           x;
+         }),
+         "int x=2; { int x=3; } x;");
+  assert(2, ({
+           int x = 2;
+           { int x = 3; }
+           int y = 4;
+           x;
+         }),
+         "int x=2; { int x=3; } int y=4; x;");
+  assert(3, ({
+           int x = 2;
+           { x = 3; }
+           x;
+         }),
+         "int x=2; { x=3; } x;");
+
+  assert(2, ({
+           int x[5];
+           int *y = x + 2;
+           y - x;
+         }),
+         "int x[5]; int *y=x+2; y-x;");
+
+  assert(1, ({
+           struct {
+             int a;
+             int b;
+           } x;
+           x.a = 1;
+           x.b = 2;
+           x.a;
+         }),
+         "struct {int a; int b;} x; x.a=1; x.b=2; x.a;");
+  assert(2, ({
+           struct {
+             int a;
+             int b;
+           } x;
+           x.a = 1;
+           x.b = 2;
+           x.b;
+         }),
+         "struct {int a; int b;} x; x.a=1; x.b=2; x.b;");
+  assert(1, ({
+           struct {
+             char a;
+             int b;
+             char c;
+           } x;
+           x.a = 1;
+           x.b = 2;
+           x.c = 3;
+           x.a;
+         }),
+         "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.a;");
+  assert(2, ({
+           struct {
+             char a;
+             int b;
+             char c;
+           } x;
+           x.b = 1;
+           x.b = 2;
+           x.c = 3;
+           x.b;
+         }),
+         "struct {char a; int b; char c;} a; x.b=x; x.a=2; x.b=3; x.b;");
+  assert(3, ({
+           struct {
+             char a;
+             int b;
+             char c;
+           } x;
+           x.a = 1;
+           x.b = 2;
+           x.c = 3;
+           x.c;
+         }),
+         "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.c;");
+
+  assert(0, ({
+           struct {
+             int a;
+             int b;
+           } x[3];
+           int *p = x;
+           p[0] = 0;
+           x[0].a;
+         }),
+         "struct {int a; int b;} x[3]; int *p=x; p[0]=0; x[0].a;");
+  assert(1, ({
+           struct {
+             int a;
+             int b;
+           } x[3];
+           int *p = x;
+           p[1] = 1;
+           x[0].b;
+         }),
+         "struct {int a; int b;} x[3]; int *p=x; p[1]=1; x[0].b;");
+  assert(2, ({
+           struct {
+             int a;
+             int b;
+           } x[3];
+           int *p = x;
+           p[2] = 2;
+           x[1].a;
+         }),
+         "struct {int a; int b;} x[3]; int *p=x; p[2]=2; x[1].a;");
+  assert(3, ({
+           struct {
+             int a;
+             int b;
+           } x[3];
+           int *p = x;
+           p[3] = 3;
+           x[1].b;
+         }),
+         "struct {int a; int b;} x[3]; int *p=x; p[3]=3; x[1].b;");
+
+  assert(6, ({
+           struct {
+             int a[3];
+             int b[5];
+           } x;
+           int *p = &x;
+           x.a[0] = 6;
+           p[0];
+         }),
+         "struct {int a[3]; int b[5];} x; int *p=&x; x.a[0]=6; p[0];");
+  assert(7, ({
+           struct {
+             int a[3];
+             int b[5];
+           } x;
+           int *p = &x;
+           x.b[0] = 7;
+           p[3];
+         }),
+         "struct {int a[3]; int b[5];} x; int *p=&x; x.b[0]=7; p[3];");
+
+  assert(6, ({
+           struct {
+             struct {
+               int b;
+             } a;
+           } x;
+           x.a.b = 6;
+           x.a.b;
+         }),
+         "struct { struct { int b; } a; } x; x.a.b=6; x.a.b;");
+
+  assert(8, ({
+           struct {
+             int a;
+           } x;
+           sizeof(x);
+         }),
+         "struct {int a;} x; sizeof(x);");
+  assert(16, ({
+           struct {
+             int a;
+             int b;
+           } x;
+           sizeof(x);
+         }),
+         "struct {int a; int b;} x; sizeof(x);");
+  assert(24, ({
+           struct {
+             int a[3];
+           } x;
+           sizeof(x);
+         }),
+         "struct {int a[3];} x; sizeof(x);");
+  assert(32, ({
+           struct {
+             int a;
+           } x[4];
+           sizeof(x);
+         }),
+         "struct {int a;} x[4]; sizeof(x);");
+  assert(48, ({
+           struct {
+             int a[3];
+           } x[2];
+           sizeof(x);
+         }),
+         "struct {int a[3];} x[2]; sizeof(x)};");
+  assert(2, ({
+           struct {
+             char a;
+             char b;
+           } x;
+           sizeof(x);
+         }),
+         "struct {char a; char b;} x; sizeof(x);");
+  assert(16, ({
+           struct {
+             char a;
+             int b;
+           } x;
+           sizeof(x);
+         }),
+         "struct {char a; int b;} x; sizeof(x);");
+  assert(16, ({
+           struct {
+             int a;
+             char b;
+           } x;
+           sizeof(x);
+         }),
+         "struct {int a; char b;} x; sizeof(x);");
+  assert(16, ({
+           struct {
+             char a;
+             char b;
+             int c;
+           } x;
+           sizeof(x);
+         }),
+         "struct {char a; char b; int c;} x; sizeof(x);");
+  assert(7, ({
+           struct {
+             char a;
+             int b;
+           } x;
+           x.a = 2;
+           x.b = 5;
+           x.a + x.b;
+         }),
+         "struct {char a; int b;} x; x.a=2; x.b=5; x.a+x.b;");
+  assert(3, ({
+           int a;
+           {
+             int b = 1;
+             a = b;
+           }
+           {
+             int c = 2;
+             a = a + c;
+           }
+           a;
+         }),
+         "int a; { int b=1; a=b; } { int c=2; a=a+c; } a;");
+
+  assert(55, ({
+           int i;
+           int s;
+           s = 0;
+           for (i = 0; i < 10; i = i + 1) s = s + i;
+           i + s;
+         }),
+         "int i; int s; s=0; for (i=0; i<10; i=i+1) s=s+i; i+s;");
+  assert(18, ({
+           int i;
+           int j;
+           int s;
+           s = 0;
+           for (i = 0; i < 3; i = i + 1)
+             for (j = 0; j < 4; j = j + 1) s = s + i * j;
+           s;
+         }),
+         "for (i=0; i<3; i=i+1) for (j=0; j<4; j=j+1) s=s+i*j; s;");
+  assert(30, ({
+           int i;
+           int x[5];
+           i = 0;
+           while (i < 5) {
+             x[i] = i * i;
+             i = i + 1;
+           }
+           x[4] + x[3] + i;
+         }),
+         "int i; int x[5]; i=0; while (i<5) { x[i]=i*i; i=i+1; } x[4]+x[3]+i;");
+  assert(27, ({
+           int i;
+           int s;
+           s = 0;
+           for (i = 0; i < 10; i = i + 1) {
+             if (i == 3) i = 7;
+             s = s + i;
+           }
+           s;
+         }),
+         "for (i=0; i<10; i=i+1) { if (i==3) i=7; s=s+i; } s;");
+  assert(5, ({
+           int i;
+           for (i = 0; i < 4; i = i + 1) g2[i] = i + 1;
+           g2[0] + g2[3];
+         }),
+         "int i; for (i=0; i<4; i=i+1) g2[i]=i+1; g2[0]+g2[3];");
+  assert(6, ({
+           int i;
+           char c[4];
+           for (i = 0; i < 4; i = i + 1) c[i] = i;
+           c[1] + c[2] + c[3];
+         }),
+         "int i; char c[4]; for (i=0; i<4; i=i+1) c[i]=i; c[1]+c[2]+c[3];");
+  assert(9, ({
+           int i;
+           int *p;
+           int x[3];
+           p = &i;
+           for (i = 0; i < 3; i = i + 1) x[i] = *p * 3;
+           x[2] + i;
+         }),
+         "p=&i; for (i=0; i<3; i=i+1) x[i]=*p*3; x[2]+i;");
+
+  assert(46, ({
+           int i;
+           int x[11];
+           int y[11];
+           int z[11];
+           for (i = 0; i < 11; i = i + 1) {
+             x[i] = i;
+             y[i] = i * 2;
+           }
+           for (i = 0; i < 11; i = i + 1) z[i] = y[i] - x[i] + y[i];
+           z[10] + z[3] - x[2] + i - 2;
+         }),
+         "for (i=0; i<11; i=i+1) z[i]=y[i]-x[i]+y[i]; z[10]+z[3]-x[2]+i-2;");
+  assert(-56, ({
+           int i;
+           char a[37];
+           char b[37];
+           for (i = 0; i < 37; i = i + 1) {
+             a[i] = 100;
+             b[i] = i;
+           }
+           for (i = 1; i < 37; i = i + 1) b[i] = a[i] + a[i];
+           b[36] + b[0];
+         }),
+         "char a[37]; char b[37]; for (i=1; i<37; i=i+1) b[i]=a[i]+a[i]; b[36]+b[0];");
+  assert(87, ({
+           int i;
+           int n;
+           int s;
+           int x[13];
+           for (i = 0; i < 13; i = i + 1) x[i] = i;
+           n = 13;
+           s = 10;
+           for (i = 2; i < n; i = i + 1) s = s + x[i];
+           s;
+         }),
+         "s=10; for (i=2; i<n; i=i+1) s=s+x[i]; s;");
+  assert(45, ({
+           int i;
+           int s;
+           int x[10];
+           int *p;
+           for (i = 0; i < 10; i = i + 1) x[i] = i;
+           p = x;
+           s = 0;
+           for (i = 0; i < 10; i = i + 1) s = p[i] + s;
+           s;
+         }),
+         "p=x; s=0; for (i=0; i<10; i=i+1) s=p[i]+s; s;");
+  assert(22, ({
+           int i;
+           int x[4];
+           for (i = 0; i < 4; i = i + 1) {
+             g2[i] = i * 3;
+             x[i] = i;
+           }
+           for (i = 0; i < 4; i = i + 1) g2[i] = g2[i] - x[i];
+           g2[3] + g2[2] + i + x[3] + x[3] + x[2];
+         }),
+         "for (i=0; i<4; i=i+1) g2[i]=g2[i]-x[i]; g2[3]+g2[2]+i+x[3]+x[3]+x[2];");
+
+  assert(50005000, sum_to(10000, 0), "sum_to(10000, 0)");
+  assert(34512, rot5(7, 1, 2, 3, 4, 5), "rot5(7, 1, 2, 3, 4, 5)");
+  assert(1, is_even(10000), "is_even(10000)");
+  assert(1, is_odd(10001), "is_odd(10001)");
+  assert(4, via_ptr(3), "via_ptr(3)");
+  assert(6, pick(5), "pick(5)");
+  assert(5, count_up(5), "count_up(5)");
+  assert(6, count_const(3), "count_const(3)");
+  assert(1, both_return(4), "both_return(4)");
+  assert(2, both_return(0), "both_return(0)");
+  assert(11, ({
+           int a[3];
+           a[0] = 5;
+           a[1] = 6;
+           int *p;
+           p = &*a;
+           *p + p[1];
+         }),
+         "int a[3]; a[0]=5; a[1]=6; int *p; p=&*a; *p+p[1];");
+  assert(7, ({
+           g2[0] = 7;
+           int *p;
+           p = &*g2;
+           *p;
+         }),
+         "g2[0]=7; int *p; p=&*g2; *p;");
+  assert(9, ({
+           int x[2][3];
+           x[1][2] = 9;
+           int *p;
+           p = &*x[1];
+           p[2];
+         }),
+         "int x[2][3]; x[1][2]=9; int *p; p=&*x[1]; p[2];");
+  assert(1, ({
+           char *p;
+           char *q;
+           p = 0;
+           q = p + 3000000000;
+           q - p == 3000000000;
+         }),
+         "char *p; char *q; p=0; q=p+3000000000; q-p==3000000000;");
+  assert(3, ({
+           int x;
+           if (1)
+             x = 3;
+           else
+             x = 4;
+           x;
+         }),
+         "if (1) x=3; else x=4; x;");
+  assert(7, ({
+           int i;
+           for (i = 7; 0; i = i + 1) i = 9;
+           i;
+         }),
+         "for (i=7; 0; i=i+1) i=9; i;");
+
+  printf("OK\n");
+  return 0;
+}
@@ -0,0 +1,4432 @@
+.intel_syntax noprefix
+.data
+.L.data.211:
+  .string "OK\012"
+.L.data.210:
+  .string "for (i=7; 0; i=i+1) i=9; i;"
+.L.data.209:
+  .string "if (1) x=3; else x=4; x;"
+.L.data.208:
+  .string "char *p; char *q; p=0; q=p+3000000000; q-p==3000000000;"
+.L.data.207:
+  .string "int x[2][3]; x[1][2]=9; int *p; p=&*x[1]; p[2];"
+.L.data.206:
+  .string "g2[0]=7; int *p; p=&*g2; *p;"
+.L.data.205:
+  .string "int a[3]; a[0]=5; a[1]=6; int *p; p=&*a; *p+p[1];"
+.L.data.204:
+  .string "both_return(0)"
+.L.data.203:
+  .string "both_return(4)"
+.L.data.202:
+  .string "count_const(3)"
+.L.data.201:
+  .string "count_up(5)"
+.L.data.200:
+  .string "pick(5)"
+.L.data.199:
+  .string "via_ptr(3)"
+.L.data.198:
+  .string "is_odd(10001)"
+.L.data.197:
+  .string "is_even(10000)"
+.L.data.196:
+  .string "rot5(7, 1, 2, 3, 4, 5)"
+.L.data.195:
+  .string "sum_to(10000, 0)"
+.L.data.194:
+  .string "for (i=0; i<4; i=i+1) g2[i]=g2[i]-x[i]; g2[3]+g2[2]+i+x[3]+x[3]+x[2];"
+.L.data.193:
+  .string "p=x; s=0; for (i=0; i<10; i=i+1) s=p[i]+s; s;"
+.L.data.192:
+  .string "s=10; for (i=2; i<n; i=i+1) s=s+x[i]; s;"
+.L.data.191:
+  .string "char a[37]; char b[37]; for (i=1; i<37; i=i+1) b[i]=a[i]+a[i]; b[36]+b[0];"
+.L.data.190:
+  .string "for (i=0; i<11; i=i+1) z[i]=y[i]-x[i]+y[i]; z[10]+z[3]-x[2]+i-2;"
+.L.data.189:
+  .string "p=&i; for (i=0; i<3; i=i+1) x[i]=*p*3; x[2]+i;"
+.L.data.188:
+  .string "int i; char c[4]; for (i=0; i<4; i=i+1) c[i]=i; c[1]+c[2]+c[3];"
+.L.data.187:
+  .string "int i; for (i=0; i<4; i=i+1) g2[i]=i+1; g2[0]+g2[3];"
+.L.data.186:
+  .string "for (i=0; i<10; i=i+1) { if (i==3) i=7; s=s+i; } s;"
+.L.data.185:
+  .string "int i; int x[5]; i=0; while (i<5) { x[i]=i*i; i=i+1; } x[4]+x[3]+i;"
+.L.data.184:
+  .string "for (i=0; i<3; i=i+1) for (j=0; j<4; j=j+1) s=s+i*j; s;"
+.L.data.183:
+  .string "int i; int s; s=0; for (i=0; i<10; i=i+1) s=s+i; i+s;"
+.L.data.182:
+  .string "int a; { int b=1; a=b; } { int c=2; a=a+c; } a;"
+.L.data.181:
+  .string "struct {char a; int b;} x; x.a=2; x.b=5; x.a+x.b;"
+.L.data.180:
+  .string "struct {char a; char b; int c;} x; sizeof(x);"
+.L.data.179:
+  .string "struct {int a; char b;} x; sizeof(x);"
+.L.data.178:
+  .string "struct {char a; int b;} x; sizeof(x);"
+.L.data.177:
+  .string "struct {char a; char b;} x; sizeof(x);"
+.L.data.176:
+  .string "struct {int a[3];} x[2]; sizeof(x)};"
+.L.data.175:
+  .string "struct {int a;} x[4]; sizeof(x);"
+.L.data.174:
+  .string "struct {int a[3];} x; sizeof(x);"
+.L.data.173:
+  .string "struct {int a; int b;} x; sizeof(x);"
+.L.data.172:
+  .string "struct {int a;} x; sizeof(x);"
+.L.data.171:
+  .string "struct { struct { int b; } a; } x; x.a.b=6; x.a.b;"
+.L.data.170:
+  .string "struct {int a[3]; int b[5];} x; int *p=&x; x.b[0]=7; p[3];"
+.L.data.169:
+  .string "struct {int a[3]; int b[5];} x; int *p=&x; x.a[0]=6; p[0];"
+.L.data.168:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[3]=3; x[1].b;"
+.L.data.167:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[2]=2; x[1].a;"
+.L.data.166:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[1]=1; x[0].b;"
+.L.data.165:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[0]=0; x[0].a;"
+.L.data.164:
+  .string "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.c;"
+.L.data.163:
+  .string "struct {char a; int b; char c;} a; x.b=x; x.a=2; x.b=3; x.b;"
+.L.data.162:
+  .string "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.a;"
+.L.data.161:
+  .string "struct {int a; int b;} x; x.a=1; x.b=2; x.b;"
+.L.data.160:
+  .string "struct {int a; int b;} x; x.a=1; x.b=2; x.a;"
+.L.data.159:
+  .string "int x[5]; int *y=x+2; y-x;"
+.L.data.158:
+  .string "int x=2; { x=3; } x;"
+.L.data.157:
+  .string "int x=2; { int x=3; } int y=4; x;"
+.L.data.156:
+  .string "int x=2; { int x=3; } x;"
+.L.data.155:
+  .string "\"\\l\"[0]"
+.L.data.154:
+  .string "l"
+.L.data.153:
+  .string "\"\\k\"[0]"
+.L.data.152:
+  .string "k"
+.L.data.151:
+  .string "\"\\j\"[0]"
+.L.data.150:
+  .string "j"
+.L.data.149:
+  .string "\"\\0\"[0]"
+.L.data.148:
+  .string "\000"
+.L.data.147:
+  .string "\"\\e\"[0]"
+.L.data.146:
+  .string "\033"
+.L.data.145:
+  .string "\"\\r\"[0]"
+.L.data.144:
+  .string "\015"
+.L.data.143:
+  .string "\"\\f\"[0]"
+.L.data.142:
+  .string "\014"
+.L.data.141:
+  .string "\"\\v\"[0]"
+.L.data.140:
+  .string "\013"
+.L.data.139:
+  .string "\"\\n\"[0]"
+.L.data.138:
+  .string "\012"
+.L.data.137:
+  .string "\"\\t\"[0]"
+.L.data.136:
+  .string "\011"
+.L.data.135:
+  .string "\"\\b\"[0]"
+.L.data.134:
+  .string "\010"
+.L.data.133:
+  .string "\"\\a\"[0]"
+.L.data.132:
+  .string "\007"
+.L.data.131:
+  .string "sizeof(\"abc\")"
+.L.data.130:
+  .string "abc"
+.L.data.129:
+  .string "\"abc\"[3]"
+.L.data.128:
+  .string "abc"
+.L.data.127:
+  .string "\"abc\"[2]"
+.L.data.126:
+  .string "abc"
+.L.data.125:
+  .string "\"abc\"[1]"
+.L.data.124:
+  .string "abc"
+.L.data.123:
+  .string "\"abc\"[0]"
+.L.data.122:
+  .string "abc"
+.L.data.121:
+  .string "sub_char(7, 3, 3)"
+.L.data.120:
+  .string "char x[10]; sizeof(x);"
+.L.data.119:
+  .string "char x; sizeof(x);"
+.L.data.118:
+  .string "char x=1; char y=2; y;"
+.L.data.117:
+  .string "char x=1; char y=2; x;"
+.L.data.116:
+  .string "char x=1; x;"
+.L.data.115:
+  .string "sizeof(g2)"
+.L.data.114:
+  .string "sizeof(g1)"
+.L.data.113:
+  .string "g1"
+.L.data.112:
+  .string "int g1=7; g1;"
+.L.data.111:
+  .string "int x=2; { int x=3; } x;"
+.L.data.110:
+  .string "g2[3]"
+.L.data.109:
+  .string "g2[2]"
+.L.data.108:
+  .string "g2[1]"
+.L.data.107:
+  .string "g2[0]"
+.L.data.106:
+  .string "g1"
+.L.data.105:
+  .string "g1"
+.L.data.104:
+  .string "int x[3][4]; sizeof(**x + 1);"
+.L.data.103:
+  .string "int x[3][4]; sizeof **x + 1;"
+.L.data.102:
+  .string "int x[3][4]; sizeof(**x) + 1;"
+.L.data.101:
+  .string "int x[3][4]; sizeof(**x);"
+.L.data.100:
+  .string "int x[3][4]; sizeof(*x);"
+.L.data.99:
+  .string "int x[3][4]; sizeof(x);"
+.L.data.98:
+  .string "int x[4]; sizeof(x);"
+.L.data.97:
+  .string "int *x; sizeof(x);"
+.L.data.96:
+  .string "int x; sizeof x;"
+.L.data.95:
+  .string "int x; sizeof(x);"
+.L.data.94:
+  .string "int x[2][3]; int *y=x; y[6]=6; x[2][0];"
+.L.data.93:
+  .string "int x[2][3]; int *y=x; y[5]=5; x[1][2];"
+.L.data.92:
+  .string "int x[2][3]; int *y=x; y[4]=4; x[1][1];"
+.L.data.91:
+  .string "int x[2][3]; int *y=x; y[3]=3; x[1][0];"
+.L.data.90:
+  .string "int x[2][3]; int *y=x; y[2]=2; x[0][2];"
+.L.data.89:
+  .string "int x[2][3]; int *y=x; y[1]=1; x[0][1];"
+.L.data.88:
+  .string "int x[2][3]; int *y=x; y[0]=0; x[0][0];"
+.L.data.87:
+  .string "int x[3]; *x=3; x[1]=4; 2[x]=5; *(x+2);"
+.L.data.86:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);"
+.L.data.85:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);"
+.L.data.84:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+1);"
+.L.data.83:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *x;"
+.L.data.82:
+  .string "int x[2][3]; int *y=x; *(y+6)=6; **(x+2);"
+.L.data.81:
+  .string "int x[2][3]; int *y=x; *(y+5)=5; *(*(x+1)+2);"
+.L.data.80:
+  .string "int x[2][3]; int *y=x; *(y+4)=4; *(*(x+1)+1);"
+.L.data.79:
+  .string "int x[2][3]; int *y=x; *(y+3)=3; **(x+1);"
+.L.data.78:
+  .string "int x[2][3]; int *y=x; *(y+2)=2; *(*x+2);"
+.L.data.77:
+  .string "int x[2][3]; int *y=x; *(y+1)=1; *(*x+1);"
+.L.data.76:
+  .string "int x[2][3]; int *y=x; *y=0; **x;"
+.L.data.75:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+2);"
+.L.data.74:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+1);"
+.L.data.73:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *x;"
+.L.data.72:
+  .string "int x[2]; int *y=&x; *y=3; *x;"
+.L.data.71:
+  .string "int x=3; int y=5; addx(&x, y);"
+.L.data.70:
+  .string "int x=3; int y=5; *(&y-1)=7; x;"
+.L.data.69:
+  .string "int x=3; int y=5; *(&x+1)=7; y;"
+.L.data.68:
+  .string "int x=3; int *y=&x; *y=5; x;"
+.L.data.67:
+  .string "int x=3; int y=5; int *z=&y; *(z-1);"
+.L.data.66:
+  .string "int x=3; int y=5; int *z=&x; *(z+1);"
+.L.data.65:
+  .string "int x=3; (&x+2)-&x;"
+.L.data.64:
+  .string "int x=3; int y=5; *(&y-1);"
+.L.data.63:
+  .string "int x=3; int y=5; *(1+&x);"
+.L.data.62:
+  .string "int x=3; int y=5; *(&x+1);"
+.L.data.61:
+  .string "int x=3; int *y=&x; int **z=&y; **z;"
+.L.data.60:
+  .string "int x=3; *&x;"
+.L.data.59:
+  .string "int x=2; clamp_add(x, clamp_add(x, 1));"
+.L.data.58:
+  .string "clamp_add(3, -4)"
+.L.data.57:
+  .string "clamp_add(3, 4)"
+.L.data.56:
+  .string "fib(9)"
+.L.data.55:
+  .string "add6(1,2,3,4,5,sub2(9,add6(1,1,1,1,1,1)))"
+.L.data.54:
+  .string "add6(1,2,3,4,5,6)"
+.L.data.53:
+  .string "sub(5, 3)"
+.L.data.52:
+  .string "add(3, 5)"
+.L.data.51:
+  .string "int x[4]; x[3]=6; *(x+1+2);"
+.L.data.50:
+  .string "int x=5; 1*x+0-0;"
+.L.data.49:
+  .string "int x=3; x=5; x=0-x; x;"
+.L.data.48:
+  .string "int x=4; int y=3; y=0-(x+y); y;"
+.L.data.47:
+  .string "int x=3; -x;"
+.L.data.46:
+  .string "int x=3; x*8;"
+.L.data.45:
+  .string "1+(2+(3+(4+(5+(6+(7+add2(3,5)))))))"
+.L.data.44:
+  .string "1+(2+(3+(4+(5+(6+(7+(8+(9+10))))))))"
+.L.data.43:
+  .string "int i=0; int j=0; for (i=0; i<=10; i=i+1) j=i+j; j;"
+.L.data.42:
+  .string "int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} j;"
+.L.data.41:
+  .string "int i=0; i=0; while(i<10) i=i+1; i;"
+.L.data.40:
+  .string "1; {2;} 3;"
+.L.data.39:
+  .string "int x=0; if (2-1) x=2; else x=3; x;"
+.L.data.38:
+  .string "int x=0; if (1) x=2; else x=3; x;"
+.L.data.37:
+  .string "int x=0; if (1-1) x=2; else x=3; x;"
+.L.data.36:
+  .string "int x=0; if (0) x=2; else x=3; x;"
+.L.data.35:
+  .string "ret3();"
+.L.data.34:
+  .string "int foo123=3; int bar=5; foo123+bar;"
+.L.data.33:
+  .string "int foo=3; foo;"
+.L.data.32:
+  .string "int a=3; int z=5; a+z;"
+.L.data.31:
+  .string "int a=3; a;"
+.L.data.30:
+  .string "int a; int z; a=3; z=5; a+z;"
+.L.data.29:
+  .string "int a; a=3; a;"
+.L.data.28:
+  .string "1>=2"
+.L.data.27:
+  .string "1>=1"
+.L.data.26:
+  .string "1>=0"
+.L.data.25:
+  .string "1>2"
+.L.data.24:
+  .string "1>1"
+.L.data.23:
+  .string "1>0"
+.L.data.22:
+  .string "2<=1"
+.L.data.21:
+  .string "1<=1"
+.L.data.20:
+  .string "0<=1"
+.L.data.19:
+  .string "2<1"
+.L.data.18:
+  .string "1<1"
+.L.data.17:
+  .string "0<1"
+.L.data.16:
+  .string "42!=42"
+.L.data.15:
+  .string "0!=1"
+.L.data.14:
+  .string "42==42"
+.L.data.13:
+  .string "0==1"
+.L.data.12:
+  .string "- - +10"
+.L.data.11:
+  .string "- -10"
+.L.data.10:
+  .string "0"
+.L.data.9:
+  .string "(3+5)/2"
+.L.data.8:
+  .string "5*(9-6)"
+.L.data.7:
+  .string "0"
+.L.data.6:
+  .string " 12 + 34 - 5 "
+.L.data.5:
+  .string "0"
+.L.data.4:
+  .string "42"
+.L.data.3:
+  .string "0"
+.L.data.2:
+  .string "int a=3; int z=5; a+z;"
+.L.data.1:
+  .string "%s => %d expected but got %d\012"
+.L.data.0:
+  .string "%s => %d\012"
+g2:
+  .zero 32
+g1:
+  .zero 8
+.text
+.global assert
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  mov [rbp-8], rdx
+  mov rax, [rbp-24]
+  mov rdi, [rbp-16]
+  cmp rax, rdi
+  jne .L.else.assert.1
+  push offset .L.data.0
+  mov rax, [rbp-8]
+  mov rdx, [rbp-16]
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call printf
+  push rax
+  add rsp, 8
+  jmp .L.end.assert.1
+.L.else.assert.1:
+  push offset .L.data.1
+  mov rax, [rbp-8]
+  push rax
+  mov rax, [rbp-24]
+  mov rcx, [rbp-16]
+  mov rdx, rax
+  pop rsi
+  pop rdi
+  mov rax, 0
+  call printf
+  push rax
+  add rsp, 8
+  mov rdi, 1
+  mov rax, 0
+  call exit
+  push rax
+  add rsp, 8
+.L.end.assert.1:
+.L.return.assert:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global ret3
+ret3:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+  mov rax, 3
+  jmp .L.return.ret3
+  mov rax, 5
+  jmp .L.return.ret3
+.L.return.ret3:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global add2
+add2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov rax, [rbp-16]
+  mov rdi, [rbp-8]
+  add rax, rdi
+  jmp .L.return.add2
+.L.return.add2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sub2
+sub2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov rax, [rbp-16]
+  mov rdi, [rbp-8]
+  sub rax, rdi
+  jmp .L.return.sub2
+.L.return.sub2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global add6
+add6:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-48], rdi
+  mov [rbp-40], rsi
+  mov [rbp-32], rdx
+  mov [rbp-24], rcx
+  mov [rbp-16], r8
+  mov [rbp-8], r9
+  mov rax, [rbp-48]
+  mov rdi, [rbp-40]
+  add rax, rdi
+  mov rdi, [rbp-32]
+  add rax, rdi
+  mov rdi, [rbp-24]
+  add rax, rdi
+  mov rdi, [rbp-16]
+  add rax, rdi
+  mov rdi, [rbp-8]
+  add rax, rdi
+  jmp .L.return.add6
+.L.return.add6:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global addx
+addx:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov rax, [rbp-16]
+  mov rax, [rax]
+  mov rdi, [rbp-8]
+  add rax, rdi
+  jmp .L.return.addx
+.L.return.addx:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sub_char
+sub_char:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-3], dil
+  mov [rbp-2], sil
+  mov [rbp-1], dl
+  movsx rax, byte ptr [rbp-3]
+  push rax
+  movsx rax, byte ptr [rbp-2]
+  mov rdi, rax
+  pop rax
+  sub rax, rdi
+  push rax
+  movsx rax, byte ptr [rbp-1]
+  mov rdi, rax
+  pop rax
+  sub rax, rdi
+  jmp .L.return.sub_char
+.L.return.sub_char:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global clamp_add
+clamp_add:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  lea rax, [rbp-8]
+  push rax
+  mov rax, [rbp-24]
+  mov rdi, [rbp-16]
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  mov rdi, 0
+  cmp rax, rdi
+  jge .L.end.clamp_add.1
+  lea rax, [rbp-8]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.end.clamp_add.1:
+  mov rax, [rbp-8]
+  jmp .L.return.clamp_add
+.L.return.clamp_add:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global fib
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  mov rdi, 1
+  cmp rax, rdi
+  jg .L.end.fib.1
+  mov rax, 1
+  jmp .L.return.fib
+.L.end.fib.1:
+  mov rax, [rbp-8]
+  sub rax, 1
+  mov rdi, rax
+  mov rax, 0
+  call fib
+  push rax
+  mov rax, [rbp-8]
+  sub rax, 2
+  mov rdi, rax
+  sub rsp, 8
+  mov rax, 0
+  call fib
+  add rsp, 8
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  jmp .L.return.fib
+.L.return.fib:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sum_to
+sum_to:
+  push rbp
+  mov rbp, rsp
+.L.tail.sum_to:
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov rax, [rbp-16]
+  mov rdi, 0
+  cmp rax, rdi
+  jne .L.end.sum_to.1
+  mov rax, [rbp-8]
+  jmp .L.return.sum_to
+.L.end.sum_to.1:
+  mov rax, [rbp-16]
+  sub rax, 1
+  push rax
+  mov rax, [rbp-8]
+  mov rdi, [rbp-16]
+  add rax, rdi
+  mov rsi, rax
+  pop rdi
+  mov rsp, rbp
+  jmp .L.tail.sum_to
+.L.return.sum_to:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global rot5
+rot5:
+  push rbp
+  mov rbp, rsp
+.L.tail.rot5:
+  sub rsp, 48
+  mov [rbp-48], rdi
+  mov [rbp-40], rsi
+  mov [rbp-32], rdx
+  mov [rbp-24], rcx
+  mov [rbp-16], r8
+  mov [rbp-8], r9
+  mov rax, [rbp-48]
+  mov rdi, 0
+  cmp rax, rdi
+  jne .L.end.rot5.1
+  mov rax, [rbp-40]
+  imul rax, 10000
+  push rax
+  mov rax, [rbp-32]
+  imul rax, 1000
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  push rax
+  mov rax, [rbp-24]
+  imul rax, 100
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  push rax
+  mov rax, [rbp-16]
+  imul rax, 10
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, [rbp-8]
+  add rax, rdi
+  jmp .L.return.rot5
+.L.end.rot5.1:
+  mov rax, [rbp-48]
+  sub rax, 1
+  push rax
+  mov rax, [rbp-32]
+  push rax
+  mov rax, [rbp-24]
+  push rax
+  mov rax, [rbp-16]
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  mov rax, [rbp-40]
+  mov r9, rax
+  pop r8
+  pop rcx
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rsp, rbp
+  jmp .L.tail.rot5
+.L.return.rot5:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global is_even
+is_even:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  mov rdi, 0
+  cmp rax, rdi
+  jne .L.end.is_even.1
+  mov rax, 1
+  jmp .L.return.is_even
+.L.end.is_even.1:
+  mov rax, [rbp-8]
+  sub rax, 1
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov rax, 0
+  jmp is_odd
+.L.return.is_even:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global is_odd
+is_odd:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  mov rdi, 0
+  cmp rax, rdi
+  jne .L.end.is_odd.1
+  mov rax, 0
+  jmp .L.return.is_odd
+.L.end.is_odd.1:
+  mov rax, [rbp-8]
+  sub rax, 1
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov rax, 0
+  jmp is_even
+.L.return.is_odd:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global via_ptr
+via_ptr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov rdi, [rbp-16]
+  mov [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  lea rax, [rbp-8]
+  mov rsi, 1
+  mov rdi, rax
+  mov rax, 0
+  call addx
+  jmp .L.return.via_ptr
+.L.return.via_ptr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global pick
+pick:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  mov [rbp-136], rdi
+  mov rax, 0
+  cmp rax, 0
+  je .L.else.pick.1
+  lea rax, [rbp-128]
+  add rax, 0
+  mov rdi, [rbp-136]
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, 1
+  jmp .L.return.pick
+  jmp .L.end.pick.1
+.L.else.pick.1:
+  mov rax, 1
+  cmp rax, 0
+  je .L.end.pick.2
+  lea rax, [rbp-136]
+  push rax
+  mov rax, [rbp-136]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.end.pick.2:
+.L.end.pick.1:
+  jmp .L.cond.pick.3
+.L.begin.pick.3:
+  lea rax, [rbp-136]
+  mov rdi, 100
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.pick.3:
+  mov rax, 0
+  cmp rax, 0
+  jne .L.begin.pick.3
+  jmp .L.cond.pick.4
+.L.begin.pick.4:
+  mov rax, [rbp-136]
+  jmp .L.return.pick
+.L.cond.pick.4:
+  jmp .L.begin.pick.4
+  mov rax, 7
+  jmp .L.return.pick
+.L.return.pick:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global count_up
+count_up:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  lea rax, [rbp-8]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.count_up.1
+.L.begin.count_up.1:
+  lea rax, [rbp-8]
+  push rax
+  mov rax, [rbp-8]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  mov rdi, [rbp-16]
+  cmp rax, rdi
+  jne .L.end.count_up.2
+  mov rax, [rbp-8]
+  jmp .L.return.count_up
+.L.end.count_up.2:
+.L.cond.count_up.1:
+  mov rax, 1
+  cmp rax, 0
+  jne .L.begin.count_up.1
+.L.return.count_up:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global count_const
+count_const:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  lea rax, [rbp-8]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.count_const.1
+.L.begin.count_const.1:
+  lea rax, [rbp-8]
+  push rax
+  mov rax, [rbp-8]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  mov rdi, [rbp-16]
+  cmp rax, rdi
+  jne .L.end.count_const.2
+  mov rax, [rbp-8]
+  imul rax, 2
+  jmp .L.return.count_const
+.L.end.count_const.2:
+.L.cond.count_const.1:
+  mov rdi, 2
+  mov rax, 1
+  cmp rax, rdi
+  jl .L.begin.count_const.1
+.L.return.count_const:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global both_return
+both_return:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  cmp rax, 0
+  je .L.else.both_return.1
+  mov rax, 1
+  jmp .L.return.both_return
+  jmp .L.end.both_return.1
+.L.else.both_return.1:
+  mov rax, 2
+  jmp .L.return.both_return
+.L.end.both_return.1:
+  mov rax, 3
+  jmp .L.return.both_return
+.L.return.both_return:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 272
+  push 8
+  mov rdi, 3
+  mov [rbp-16], rdi
+  mov rdi, 5
+  mov [rbp-8], rdi
+  mov rax, [rbp-16]
+  mov rdi, [rbp-8]
+  add rax, rdi
+  mov rdx, offset .L.data.2
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 0
+  mov rdx, offset .L.data.3
+  mov rsi, 0
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 42
+  mov rdx, offset .L.data.4
+  mov rsi, 42
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 5
+  mov rdx, offset .L.data.5
+  mov rsi, 5
+  pop rdi
+  mov rax, 0
+  call assert
+  push 41
+  mov rax, 12
+  add rax, 34
+  sub rax, 5
+  mov rdx, offset .L.data.6
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 5
+  mov rdx, offset .L.data.7
+  mov rsi, 5
+  pop rdi
+  mov rax, 0
+  call assert
+  push 15
+  push 5
+  mov rax, 9
+  sub rax, 6
+  mov rdi, rax
+  pop rax
+  imul rax, rdi
+  mov rdx, offset .L.data.8
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 4
+  mov rax, 3
+  add rax, 5
+  mov rdi, 2
+  cqo
+  idiv rdi
+  mov rdx, offset .L.data.9
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  mov rax, 0
+  sub rax, 10
+  push rax
+  mov rax, 0
+  sub rax, 10
+  mov rdx, offset .L.data.10
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 10
+  push 0
+  mov rax, 0
+  sub rax, 10
+  mov rdi, rax
+  pop rax
+  sub rax, rdi
+  mov rdx, offset .L.data.11
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 10
+  push 0
+  mov rax, 0
+  sub rax, 10
+  mov rdi, rax
+  pop rax
+  sub rax, rdi
+  mov rdx, offset .L.data.12
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 0
+  mov rax, 0
+  cmp rax, 1
+  sete al
+  movzb rax, al
+  mov rdx, offset .L.data.13
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  mov rax, 42
+  cmp rax, 42
+  sete al
+  movzb rax, al
+  mov rdx, offset .L.data.14
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  mov rax, 0
+  cmp rax, 1
+  setne al
+  movzb rax, al
+  mov rdx, offset .L.data.15
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 0
+  mov rax, 42
+  cmp rax, 42
+  setne al
+  movzb rax, al
+  mov rdx, offset .L.data.16
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  mov rax, 0
+  cmp rax, 1
+  setl al
+  movzb rax, al
+  mov rdx, offset .L.data.17
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 0
+  mov rax, 1
+  cmp rax, 1
+  setl al
+  movzb rax, al
+  mov rdx, offset .L.data.18
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 0
+  mov rax, 2
+  cmp rax, 1
+  setl al
+  movzb rax, al
+  mov rdx, offset .L.data.19
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  mov rax, 0
+  cmp rax, 1
+  setle al
+  movzb rax, al
+  mov rdx, offset .L.data.20
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  mov rax, 1
+  cmp rax, 1
+  setle al
+  movzb rax, al
+  mov rdx, offset .L.data.21
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 0
+  mov rax, 2
+  cmp rax, 1
+  setle al
+  movzb rax, al
+  mov rdx, offset .L.data.22
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  mov rax, 0
+  cmp rax, 1
+  setl al
+  movzb rax, al
+  mov rdx, offset .L.data.23
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 0
+  mov rax, 1
+  cmp rax, 1
+  setl al
+  movzb rax, al
+  mov rdx, offset .L.data.24
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 0
+  mov rax, 2
+  cmp rax, 1
+  setl al
+  movzb rax, al
+  mov rdx, offset .L.data.25
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  mov rax, 0
+  cmp rax, 1
+  setle al
+  movzb rax, al
+  mov rdx, offset .L.data.26
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  mov rax, 1
+  cmp rax, 1
+  setle al
+  movzb rax, al
+  mov rdx, offset .L.data.27
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 0
+  mov rax, 2
+  cmp rax, 1
+  setle al
+  movzb rax, al
+  mov rdx, offset .L.data.28
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  mov rdi, 3
+  mov [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.29
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 8
+  mov rdi, 3
+  mov [rbp-16], rdi
+  mov rdi, 5
+  mov [rbp-8], rdi
+  mov rax, [rbp-16]
+  mov rdi, [rbp-8]
+  add rax, rdi
+  mov rdx, offset .L.data.30
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  mov rdi, 3
+  mov [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.31
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 8
+  mov rdi, 3
+  mov [rbp-16], rdi
+  mov rdi, 5
+  mov [rbp-8], rdi
+  mov rax, [rbp-16]
+  mov rdi, [rbp-8]
+  add rax, rdi
+  mov rdx, offset .L.data.32
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  mov rdi, 3
+  mov [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.33
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 8
+  mov rdi, 3
+  mov [rbp-16], rdi
+  mov rdi, 5
+  mov [rbp-8], rdi
+  mov rax, [rbp-16]
+  mov rdi, [rbp-8]
+  add rax, rdi
+  mov rdx, offset .L.data.34
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  sub rsp, 8
+  mov rax, 0
+  call ret3
+  add rsp, 8
+  mov rdx, offset .L.data.35
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  mov rdi, 0
+  mov [rbp-8], rdi
+  mov rax, 0
+  cmp rax, 0
+  je .L.else.main.1
+  lea rax, [rbp-8]
+  mov rdi, 2
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.1
+.L.else.main.1:
+  lea rax, [rbp-8]
+  mov rdi, 3
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.end.main.1:
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.36
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  mov rdi, 0
+  mov [rbp-8], rdi
+  mov rdi, 1
+  mov rax, 1
+  sub rax, rdi
+  cmp rax, 0
+  je .L.else.main.2
+  lea rax, [rbp-8]
+  mov rdi, 2
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.2
+.L.else.main.2:
+  lea rax, [rbp-8]
+  mov rdi, 3
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.end.main.2:
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.37
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 2
+  mov rdi, 0
+  mov [rbp-8], rdi
+  mov rax, 1
+  cmp rax, 0
+  je .L.else.main.3
+  lea rax, [rbp-8]
+  mov rdi, 2
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.3
+.L.else.main.3:
+  lea rax, [rbp-8]
+  mov rdi, 3
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.end.main.3:
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.38
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 2
+  mov rdi, 0
+  mov [rbp-8], rdi
+  mov rdi, 1
+  mov rax, 2
+  sub rax, rdi
+  cmp rax, 0
+  je .L.else.main.4
+  lea rax, [rbp-8]
+  mov rdi, 2
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.4
+.L.else.main.4:
+  lea rax, [rbp-8]
+  mov rdi, 3
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.end.main.4:
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.39
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  push 2
+  add rsp, 8
+  mov rdx, offset .L.data.40
+  mov rsi, 3
+  pop rdi
+  mov rax, 0
+  call assert
+  push 10
+  mov rdi, 0
+  mov [rbp-8], rdi
+  lea rax, [rbp-8]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.5
+.L.begin.main.5:
+  lea rax, [rbp-8]
+  push rax
+  mov rax, [rbp-8]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.5:
+  mov rax, [rbp-8]
+  mov rdi, 10
+  cmp rax, rdi
+  jl .L.begin.main.5
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.41
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 55
+  mov rdi, 0
+  mov [rbp-16], rdi
+  lea rax, [rbp-8]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.6
+.L.begin.main.6:
+  lea rax, [rbp-8]
+  push rax
+  mov rax, [rbp-16]
+  mov rdi, [rbp-8]
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-16]
+  push rax
+  mov rax, [rbp-16]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.6:
+  mov rax, [rbp-16]
+  mov rdi, 10
+  cmp rax, rdi
+  jle .L.begin.main.6
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.42
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 55
+  mov rdi, 0
+  mov [rbp-16], rdi
+  mov rdi, 0
+  mov [rbp-8], rdi
+  lea rax, [rbp-16]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.7
+.L.begin.main.7:
+  lea rax, [rbp-8]
+  push rax
+  mov rax, [rbp-16]
+  mov rdi, [rbp-8]
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-16]
+  push rax
+  mov rax, [rbp-16]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.7:
+  mov rax, [rbp-16]
+  mov rdi, 10
+  cmp rax, rdi
+  jle .L.begin.main.7
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.43
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 55
+  push 1
+  push 2
+  push 3
+  push 4
+  push 5
+  push 6
+  push 7
+  push 8
+  mov rax, 9
+  add rax, 10
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdx, offset .L.data.44
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 36
+  push 1
+  push 2
+  push 3
+  push 4
+  push 5
+  push 6
+  push 7
+  mov rsi, 5
+  mov rdi, 3
+  mov rax, 0
+  call add2
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdx, offset .L.data.45
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 24
+  mov rdi, 3
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  imul rax, 8
+  mov rdx, offset .L.data.46
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  mov rax, 0
+  sub rax, 3
+  push rax
+  mov rdi, 3
+  mov [rbp-8], rdi
+  mov rdi, [rbp-8]
+  mov rax, 0
+  sub rax, rdi
+  mov rdx, offset .L.data.47
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  mov rax, 0
+  sub rax, 7
+  push rax
+  mov rdi, 4
+  mov [rbp-16], rdi
+  mov rdi, 3
+  mov [rbp-8], rdi
+  lea rax, [rbp-8]
+  push rax
+  push 0
+  mov rax, [rbp-16]
+  mov rdi, [rbp-8]
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  sub rax, rdi
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.48
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  mov rax, 0
+  sub rax, 5
+  push rax
+  mov rdi, 3
+  mov [rbp-8], rdi
+  mov rdi, 5
+  mov [rbp-8], rdi
+  lea rax, [rbp-8]
+  push rax
+  mov rdi, [rbp-8]
+  mov rax, 0
+  sub rax, rdi
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.49
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 5
+  mov rdi, 5
+  mov [rbp-8], rdi
+  mov rdi, [rbp-8]
+  mov rax, 1
+  imul rax, rdi
+  add rax, 0
+  sub rax, 0
+  mov rdx, offset .L.data.50
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 6
+  lea rax, [rbp-32]
+  add rax, 24
+  mov rdi, 6
+  mov [rax], rdi
+  lea rax, [rbp-32]
+  add rax, 8
+  add rax, 16
+  mov rax, [rax]
+  mov rdx, offset .L.data.51
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 8
+  mov rsi, 5
+  mov rdi, 3
+  sub rsp, 8
+  mov rax, 0
+  call add2
+  add rsp, 8
+  mov rdx, offset .L.data.52
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 2
+  mov rsi, 3
+  mov rdi, 5
+  sub rsp, 8
+  mov rax, 0
+  call sub2
+  add rsp, 8
+  mov rdx, offset .L.data.53
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 21
+  push 1
+  push 2
+  push 3
+  push 4
+  mov r9, 6
+  mov r8, 5
+  pop rcx
+  pop rdx
+  pop rsi
+  pop rdi
+  sub rsp, 8
+  mov rax, 0
+  call add6
+  add rsp, 8
+  mov rdx, offset .L.data.54
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 18
+  push 1
+  push 2
+  push 3
+  push 4
+  push 5
+  push 9
+  push 1
+  push 1
+  push 1
+  push 1
+  mov r9, 1
+  mov r8, 1
+  pop rcx
+  pop rdx
+  pop rsi
+  pop rdi
+  sub rsp, 8
+  mov rax, 0
+  call add6
+  add rsp, 8
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call sub2
+  mov r9, rax
+  pop r8
+  pop rcx
+  pop rdx
+  pop rsi
+  pop rdi
+  sub rsp, 8
+  mov rax, 0
+  call add6
+  add rsp, 8
+  mov rdx, offset .L.data.55
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 55
+  mov rdi, 9
+  sub rsp, 8
+  mov rax, 0
+  call fib
+  add rsp, 8
+  mov rdx, offset .L.data.56
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 7
+  mov rsi, 4
+  mov rdi, 3
+  sub rsp, 8
+  mov rax, 0
+  call clamp_add
+  add rsp, 8
+  mov rdx, offset .L.data.57
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 0
+  push 3
+  mov rax, 0
+  sub rax, 4
+  mov rsi, rax
+  pop rdi
+  sub rsp, 8
+  mov rax, 0
+  call clamp_add
+  add rsp, 8
+  mov rdx, offset .L.data.58
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 5
+  mov rdi, 2
+  mov [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-8]
+  push rax
+  mov rax, [rbp-8]
+  mov rsi, 1
+  mov rdi, rax
+  mov rax, 0
+  call clamp_add
+  mov rsi, rax
+  pop rdi
+  sub rsp, 8
+  mov rax, 0
+  call clamp_add
+  add rsp, 8
+  mov rdx, offset .L.data.59
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  mov rdi, 3
+  mov [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.60
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  mov rdi, 3
+  mov [rbp-24], rdi
+  lea rax, [rbp-16]
+  push rax
+  lea rax, [rbp-24]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-16]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-8]
+  mov rax, [rax]
+  mov rax, [rax]
+  mov rdx, offset .L.data.61
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 5
+  mov rdi, 3
+  mov [rbp-16], rdi
+  mov rdi, 5
+  mov [rbp-8], rdi
+  lea rax, [rbp-16]
+  add rax, 8
+  mov rax, [rax]
+  mov rdx, offset .L.data.62
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 5
+  mov rdi, 3
+  mov [rbp-16], rdi
+  mov rdi, 5
+  mov [rbp-8], rdi
+  lea rax, [rbp-16]
+  add rax, 8
+  mov rax, [rax]
+  mov rdx, offset .L.data.63
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  mov rdi, 3
+  mov [rbp-16], rdi
+  mov rdi, 5
+  mov [rbp-8], rdi
+  lea rax, [rbp-8]
+  mov rdi, 1
+  imul rdi, 8
+  sub rax, rdi
+  mov rax, [rax]
+  mov rdx, offset .L.data.64
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 2
+  mov rdi, 3
+  mov [rbp-8], rdi
+  lea rax, [rbp-8]
+  add rax, 16
+  push rax
+  lea rax, [rbp-8]
+  mov rdi, rax
+  pop rax
+  sub rax, rdi
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov rdx, offset .L.data.65
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 5
+  mov rdi, 3
+  mov [rbp-24], rdi
+  mov rdi, 5
+  mov [rbp-16], rdi
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-24]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 8
+  mov rax, [rax]
+  mov rdx, offset .L.data.66
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  mov rdi, 3
+  mov [rbp-24], rdi
+  mov rdi, 5
+  mov [rbp-16], rdi
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-16]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  mov rdi, 1
+  imul rdi, 8
+  sub rax, rdi
+  mov rax, [rax]
+  mov rdx, offset .L.data.67
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 5
+  mov rdi, 3
+  mov [rbp-16], rdi
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-16]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  mov rdi, 5
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-16]
+  mov rdx, offset .L.data.68
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 7
+  mov rdi, 3
+  mov [rbp-16], rdi
+  mov rdi, 5
+  mov [rbp-8], rdi
+  lea rax, [rbp-16]
+  add rax, 8
+  mov rdi, 7
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.69
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 7
+  mov rdi, 3
+  mov [rbp-16], rdi
+  mov rdi, 5
+  mov [rbp-8], rdi
+  lea rax, [rbp-8]
+  mov rdi, 1
+  imul rdi, 8
+  sub rax, rdi
+  mov rdi, 7
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-16]
+  mov rdx, offset .L.data.70
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 8
+  mov rdi, 3
+  mov [rbp-16], rdi
+  mov rdi, 5
+  mov [rbp-8], rdi
+  lea rax, [rbp-16]
+  mov rsi, [rbp-8]
+  mov rdi, rax
+  sub rsp, 8
+  mov rax, 0
+  call addx
+  add rsp, 8
+  mov rdx, offset .L.data.71
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-24]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  mov rdi, 3
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-24]
+  mov rdx, offset .L.data.72
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  mov rdi, 3
+  mov [rbp-24], rdi
+  lea rax, [rbp-24]
+  add rax, 8
+  mov rdi, 4
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 16
+  mov rdi, 5
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-24]
+  mov rdx, offset .L.data.73
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 4
+  mov rdi, 3
+  mov [rbp-24], rdi
+  lea rax, [rbp-24]
+  add rax, 8
+  mov rdi, 4
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 16
+  mov rdi, 5
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 8
+  mov rax, [rax]
+  mov rdx, offset .L.data.74
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 5
+  mov rdi, 3
+  mov [rbp-24], rdi
+  lea rax, [rbp-24]
+  add rax, 8
+  mov rdi, 4
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 16
+  mov rdi, 5
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 16
+  mov rax, [rax]
+  mov rdx, offset .L.data.75
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 0
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-56]
+  mov rdx, offset .L.data.76
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 8
+  mov rdi, 1
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 8
+  mov rax, [rax]
+  mov rdx, offset .L.data.77
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 2
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 16
+  mov rdi, 2
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 16
+  mov rax, [rax]
+  mov rdx, offset .L.data.78
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 24
+  mov rdi, 3
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 24
+  mov rax, [rax]
+  mov rdx, offset .L.data.79
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 4
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 32
+  mov rdi, 4
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 24
+  add rax, 8
+  mov rax, [rax]
+  mov rdx, offset .L.data.80
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 5
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 40
+  mov rdi, 5
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 24
+  add rax, 16
+  mov rax, [rax]
+  mov rdx, offset .L.data.81
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 6
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 48
+  mov rdi, 6
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 48
+  mov rax, [rax]
+  mov rdx, offset .L.data.82
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  mov rdi, 3
+  mov [rbp-24], rdi
+  lea rax, [rbp-24]
+  add rax, 8
+  mov rdi, 4
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 16
+  mov rdi, 5
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-24]
+  mov rdx, offset .L.data.83
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 4
+  mov rdi, 3
+  mov [rbp-24], rdi
+  lea rax, [rbp-24]
+  add rax, 8
+  mov rdi, 4
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 16
+  mov rdi, 5
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 8
+  mov rax, [rax]
+  mov rdx, offset .L.data.84
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 5
+  mov rdi, 3
+  mov [rbp-24], rdi
+  lea rax, [rbp-24]
+  add rax, 8
+  mov rdi, 4
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 16
+  mov rdi, 5
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 16
+  mov rax, [rax]
+  mov rdx, offset .L.data.85
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 5
+  mov rdi, 3
+  mov [rbp-24], rdi
+  lea rax, [rbp-24]
+  add rax, 8
+  mov rdi, 4
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 16
+  mov rdi, 5
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 16
+  mov rax, [rax]
+  mov rdx, offset .L.data.86
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 5
+  mov rdi, 3
+  mov [rbp-24], rdi
+  lea rax, [rbp-24]
+  add rax, 8
+  mov rdi, 4
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 16
+  mov rdi, 5
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 16
+  mov rax, [rax]
+  mov rdx, offset .L.data.87
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 0
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 0
+  mov rdi, 0
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 0
+  add rax, 0
+  mov rax, [rax]
+  mov rdx, offset .L.data.88
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 8
+  mov rdi, 1
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 0
+  add rax, 8
+  mov rax, [rax]
+  mov rdx, offset .L.data.89
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 2
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 16
+  mov rdi, 2
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 0
+  add rax, 16
+  mov rax, [rax]
+  mov rdx, offset .L.data.90
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 24
+  mov rdi, 3
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 24
+  add rax, 0
+  mov rax, [rax]
+  mov rdx, offset .L.data.91
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 4
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 32
+  mov rdi, 4
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 24
+  add rax, 8
+  mov rax, [rax]
+  mov rdx, offset .L.data.92
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 5
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 40
+  mov rdi, 5
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 24
+  add rax, 16
+  mov rax, [rax]
+  mov rdx, offset .L.data.93
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 6
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 48
+  mov rdi, 6
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 48
+  add rax, 0
+  mov rax, [rax]
+  mov rdx, offset .L.data.94
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 8
+  mov rdx, offset .L.data.95
+  mov rsi, 8
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 8
+  mov rdx, offset .L.data.96
+  mov rsi, 8
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 8
+  mov rdx, offset .L.data.97
+  mov rsi, 8
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 32
+  mov rdx, offset .L.data.98
+  mov rsi, 32
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 96
+  mov rdx, offset .L.data.99
+  mov rsi, 96
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 32
+  mov rdx, offset .L.data.100
+  mov rsi, 32
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 8
+  mov rdx, offset .L.data.101
+  mov rsi, 8
+  pop rdi
+  mov rax, 0
+  call assert
+  push 9
+  mov rax, 8
+  add rax, 1
+  mov rdx, offset .L.data.102
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 9
+  mov rax, 8
+  add rax, 1
+  mov rdx, offset .L.data.103
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 8
+  mov rdx, offset .L.data.104
+  mov rsi, 8
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, offset g1
+  mov rax, [rax]
+  mov rdx, offset .L.data.105
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  mov rdi, 3
+  mov rax, offset g1
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  push 3
+  mov rax, offset g1
+  mov rax, [rax]
+  mov rdx, offset .L.data.106
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  mov rax, offset g2
+  add rax, 0
+  mov rdi, 0
+  mov [rax], rdi
+  mov rax, offset g2
+  add rax, 8
+  mov rdi, 1
+  mov [rax], rdi
+  mov rax, offset g2
+  add rax, 16
+  mov rdi, 2
+  mov [rax], rdi
+  mov rax, offset g2
+  add rax, 24
+  mov rdi, 3
+  mov [rax], rdi
+  push 0
+  mov rax, offset g2
+  add rax, 0
+  mov rax, [rax]
+  mov rdx, offset .L.data.107
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  mov rax, offset g2
+  add rax, 8
+  mov rax, [rax]
+  mov rdx, offset .L.data.108
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 2
+  mov rax, offset g2
+  add rax, 16
+  mov rax, [rax]
+  mov rdx, offset .L.data.109
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  mov rax, offset g2
+  add rax, 24
+  mov rax, [rax]
+  mov rdx, offset .L.data.110
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 2
+  mov rdi, 2
+  mov [rbp-8], rdi
+  mov rdi, 3
+  mov [rbp-16], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.111
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 7
+  mov rdi, 7
+  mov [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.112
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, offset g1
+  mov rax, [rax]
+  mov rdx, offset .L.data.113
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 8
+  mov rdx, offset .L.data.114
+  mov rsi, 8
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 32
+  mov rdx, offset .L.data.115
+  mov rsi, 32
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  mov rdi, 1
+  mov [rbp-1], dil
+  push rdi
+  add rsp, 8
+  movsx rax, byte ptr [rbp-1]
+  mov rdx, offset .L.data.116
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  mov rdi, 1
+  mov [rbp-2], dil
+  mov rdi, 2
+  mov [rbp-1], dil
+  push rdi
+  add rsp, 8
+  movsx rax, byte ptr [rbp-2]
+  mov rdx, offset .L.data.117
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 2
+  mov rdi, 1
+  mov [rbp-2], dil
+  mov rdi, 2
+  mov [rbp-1], dil
+  push rdi
+  add rsp, 8
+  movsx rax, byte ptr [rbp-1]
+  mov rdx, offset .L.data.118
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 1
+  mov rdx, offset .L.data.119
+  mov rsi, 1
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 10
+  mov rdx, offset .L.data.120
+  mov rsi, 10
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  push 7
+  mov rdx, 3
+  mov rsi, 3
+  pop rdi
+  sub rsp, 8
+  mov rax, 0
+  call sub_char
+  add rsp, 8
+  mov rdx, offset .L.data.121
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 97
+  mov rax, offset .L.data.122
+  add rax, 0
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.123
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 98
+  mov rax, offset .L.data.124
+  add rax, 1
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.125
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 99
+  mov rax, offset .L.data.126
+  add rax, 2
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.127
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 0
+  mov rax, offset .L.data.128
+  add rax, 3
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.129
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 4
+  mov rdx, offset .L.data.131
+  mov rsi, 4
+  pop rdi
+  mov rax, 0
+  call assert
+  push 7
+  mov rax, offset .L.data.132
+  add rax, 0
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.133
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 8
+  mov rax, offset .L.data.134
+  add rax, 0
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.135
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 9
+  mov rax, offset .L.data.136
+  add rax, 0
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.137
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 10
+  mov rax, offset .L.data.138
+  add rax, 0
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.139
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 11
+  mov rax, offset .L.data.140
+  add rax, 0
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.141
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 12
+  mov rax, offset .L.data.142
+  add rax, 0
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.143
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 13
+  mov rax, offset .L.data.144
+  add rax, 0
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.145
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 27
+  mov rax, offset .L.data.146
+  add rax, 0
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.147
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 0
+  mov rax, offset .L.data.148
+  add rax, 0
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.149
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 106
+  mov rax, offset .L.data.150
+  add rax, 0
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.151
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 107
+  mov rax, offset .L.data.152
+  add rax, 0
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.153
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 108
+  mov rax, offset .L.data.154
+  add rax, 0
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.155
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 2
+  mov rdi, 2
+  mov [rbp-8], rdi
+  mov rdi, 3
+  mov [rbp-16], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.156
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 2
+  mov rdi, 2
+  mov [rbp-16], rdi
+  mov rdi, 3
+  mov [rbp-24], rdi
+  mov rdi, 4
+  mov [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-16]
+  mov rdx, offset .L.data.157
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  mov rdi, 2
+  mov [rbp-8], rdi
+  mov rdi, 3
+  mov [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.158
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 2
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-48]
+  add rax, 16
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  push rax
+  lea rax, [rbp-48]
+  mov rdi, rax
+  pop rax
+  sub rax, rdi
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov rdx, offset .L.data.159
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  lea rax, [rbp-16]
+  add rax, 0
+  mov rdi, 1
+  mov [rax], rdi
+  lea rax, [rbp-16]
+  add rax, 8
+  mov rdi, 2
+  mov [rax], rdi
+  lea rax, [rbp-16]
+  add rax, 0
+  mov rax, [rax]
+  mov rdx, offset .L.data.160
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 2
+  lea rax, [rbp-16]
+  add rax, 0
+  mov rdi, 1
+  mov [rax], rdi
+  lea rax, [rbp-16]
+  add rax, 8
+  mov rdi, 2
+  mov [rax], rdi
+  lea rax, [rbp-16]
+  add rax, 8
+  mov rax, [rax]
+  mov rdx, offset .L.data.161
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  lea rax, [rbp-24]
+  add rax, 0
+  mov rdi, 1
+  mov [rax], dil
+  lea rax, [rbp-24]
+  add rax, 8
+  mov rdi, 2
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 16
+  mov rdi, 3
+  mov [rax], dil
+  lea rax, [rbp-24]
+  add rax, 0
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.162
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 2
+  lea rax, [rbp-24]
+  add rax, 8
+  mov rdi, 1
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 8
+  mov rdi, 2
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 16
+  mov rdi, 3
+  mov [rax], dil
+  lea rax, [rbp-24]
+  add rax, 8
+  mov rax, [rax]
+  mov rdx, offset .L.data.163
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  lea rax, [rbp-24]
+  add rax, 0
+  mov rdi, 1
+  mov [rax], dil
+  lea rax, [rbp-24]
+  add rax, 8
+  mov rdi, 2
+  mov [rax], rdi
+  lea rax, [rbp-24]
+  add rax, 16
+  mov rdi, 3
+  mov [rax], dil
+  lea rax, [rbp-24]
+  add rax, 16
+  movsx rax, byte ptr [rax]
+  mov rdx, offset .L.data.164
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 0
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 0
+  mov rdi, 0
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 0
+  add rax, 0
+  mov rax, [rax]
+  mov rdx, offset .L.data.165
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 8
+  mov rdi, 1
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 0
+  add rax, 8
+  mov rax, [rax]
+  mov rdx, offset .L.data.166
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 2
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 16
+  mov rdi, 2
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 16
+  add rax, 0
+  mov rax, [rax]
+  mov rdx, offset .L.data.167
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 24
+  mov rdi, 3
+  mov [rax], rdi
+  lea rax, [rbp-56]
+  add rax, 16
+  add rax, 8
+  mov rax, [rax]
+  mov rdx, offset .L.data.168
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 6
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-72]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-72]
+  add rax, 0
+  add rax, 0
+  mov rdi, 6
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 0
+  mov rax, [rax]
+  mov rdx, offset .L.data.169
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 7
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-72]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-72]
+  add rax, 24
+  add rax, 0
+  mov rdi, 7
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 24
+  mov rax, [rax]
+  mov rdx, offset .L.data.170
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 6
+  lea rax, [rbp-8]
+  add rax, 0
+  add rax, 0
+  mov rdi, 6
+  mov [rax], rdi
+  lea rax, [rbp-8]
+  add rax, 0
+  add rax, 0
+  mov rax, [rax]
+  mov rdx, offset .L.data.171
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 8
+  mov rdx, offset .L.data.172
+  mov rsi, 8
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 16
+  mov rdx, offset .L.data.173
+  mov rsi, 16
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 24
+  mov rdx, offset .L.data.174
+  mov rsi, 24
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 32
+  mov rdx, offset .L.data.175
+  mov rsi, 32
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 48
+  mov rdx, offset .L.data.176
+  mov rsi, 48
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 2
+  mov rdx, offset .L.data.177
+  mov rsi, 2
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 16
+  mov rdx, offset .L.data.178
+  mov rsi, 16
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 16
+  mov rdx, offset .L.data.179
+  mov rsi, 16
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  push 16
+  mov rdx, offset .L.data.180
+  mov rsi, 16
+  pop rdi
+  mov rax, 0
+  call assert
+  push 7
+  lea rax, [rbp-16]
+  add rax, 0
+  mov rdi, 2
+  mov [rax], dil
+  lea rax, [rbp-16]
+  add rax, 8
+  mov rdi, 5
+  mov [rax], rdi
+  lea rax, [rbp-16]
+  add rax, 0
+  movsx rax, byte ptr [rax]
+  push rax
+  lea rax, [rbp-16]
+  add rax, 8
+  mov rax, [rax]
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdx, offset .L.data.181
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  mov rdi, 1
+  mov [rbp-16], rdi
+  mov rdi, [rbp-16]
+  mov [rbp-8], rdi
+  mov rdi, 2
+  mov [rbp-16], rdi
+  lea rax, [rbp-8]
+  push rax
+  mov rax, [rbp-8]
+  mov rdi, [rbp-16]
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.182
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 55
+  mov rdi, 0
+  mov [rbp-8], rdi
+  lea rax, [rbp-16]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.8
+.L.begin.main.8:
+  lea rax, [rbp-8]
+  push rax
+  mov rax, [rbp-8]
+  mov rdi, [rbp-16]
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-16]
+  push rax
+  mov rax, [rbp-16]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.8:
+  mov rax, [rbp-16]
+  mov rdi, 10
+  cmp rax, rdi
+  jl .L.begin.main.8
+  mov rax, [rbp-16]
+  mov rdi, [rbp-8]
+  add rax, rdi
+  mov rdx, offset .L.data.183
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 18
+  mov rdi, 0
+  mov [rbp-8], rdi
+  lea rax, [rbp-24]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.9
+.L.begin.main.9:
+  lea rax, [rbp-16]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.10
+.L.begin.main.10:
+  lea rax, [rbp-8]
+  push rax
+  mov rax, [rbp-8]
+  push rax
+  mov rax, [rbp-24]
+  mov rdi, [rbp-16]
+  imul rax, rdi
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-16]
+  push rax
+  mov rax, [rbp-16]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.10:
+  mov rax, [rbp-16]
+  mov rdi, 4
+  cmp rax, rdi
+  jl .L.begin.main.10
+  lea rax, [rbp-24]
+  push rax
+  mov rax, [rbp-24]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.9:
+  mov rax, [rbp-24]
+  mov rdi, 3
+  cmp rax, rdi
+  jl .L.begin.main.9
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.184
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 30
+  lea rax, [rbp-48]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.11
+.L.begin.main.11:
+  lea rax, [rbp-40]
+  mov rdi, [rbp-48]
+  lea rax, [rax+rdi*8]
+  push rax
+  mov rax, [rbp-48]
+  mov rdi, [rbp-48]
+  imul rax, rdi
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-48]
+  push rax
+  mov rax, [rbp-48]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.11:
+  mov rax, [rbp-48]
+  mov rdi, 5
+  cmp rax, rdi
+  jl .L.begin.main.11
+  lea rax, [rbp-40]
+  add rax, 32
+  mov rax, [rax]
+  push rax
+  lea rax, [rbp-40]
+  add rax, 24
+  mov rax, [rax]
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, [rbp-48]
+  add rax, rdi
+  mov rdx, offset .L.data.185
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 27
+  mov rdi, 0
+  mov [rbp-8], rdi
+  lea rax, [rbp-16]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.12
+.L.begin.main.12:
+  mov rax, [rbp-16]
+  mov rdi, 3
+  cmp rax, rdi
+  jne .L.end.main.13
+  lea rax, [rbp-16]
+  mov rdi, 7
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.end.main.13:
+  lea rax, [rbp-8]
+  push rax
+  mov rax, [rbp-8]
+  mov rdi, [rbp-16]
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-16]
+  push rax
+  mov rax, [rbp-16]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.12:
+  mov rax, [rbp-16]
+  mov rdi, 10
+  cmp rax, rdi
+  jl .L.begin.main.12
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.186
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 5
+  lea rax, [rbp-8]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.14
+.L.begin.main.14:
+  mov rdi, [rbp-8]
+  mov rax, offset g2
+  lea rax, [rax+rdi*8]
+  push rax
+  mov rax, [rbp-8]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-8]
+  push rax
+  mov rax, [rbp-8]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.14:
+  mov rax, [rbp-8]
+  mov rdi, 4
+  cmp rax, rdi
+  jl .L.begin.main.14
+  mov rax, offset g2
+  add rax, 0
+  mov rax, [rax]
+  push rax
+  mov rax, offset g2
+  add rax, 24
+  mov rax, [rax]
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdx, offset .L.data.187
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 6
+  lea rax, [rbp-8]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.15
+.L.begin.main.15:
+  lea rax, [rbp-12]
+  mov rdi, [rbp-8]
+  lea rax, [rax+rdi*1]
+  mov rdi, [rbp-8]
+  mov [rax], dil
+  lea rax, [rbp-8]
+  push rax
+  mov rax, [rbp-8]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.15:
+  mov rax, [rbp-8]
+  mov rdi, 4
+  cmp rax, rdi
+  jl .L.begin.main.15
+  lea rax, [rbp-12]
+  add rax, 1
+  movsx rax, byte ptr [rax]
+  push rax
+  lea rax, [rbp-12]
+  add rax, 2
+  movsx rax, byte ptr [rax]
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rbp-12]
+  add rax, 3
+  movsx rax, byte ptr [rax]
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdx, offset .L.data.188
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 9
+  lea rax, [rbp-32]
+  push rax
+  lea rax, [rbp-40]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-40]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.16
+.L.begin.main.16:
+  lea rax, [rbp-24]
+  mov rdi, [rbp-40]
+  lea rax, [rax+rdi*8]
+  push rax
+  mov rax, [rbp-32]
+  mov rax, [rax]
+  imul rax, 3
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-40]
+  push rax
+  mov rax, [rbp-40]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.16:
+  mov rax, [rbp-40]
+  mov rdi, 3
+  cmp rax, rdi
+  jl .L.begin.main.16
+  lea rax, [rbp-24]
+  add rax, 16
+  mov rax, [rax]
+  mov rdi, [rbp-40]
+  add rax, rdi
+  mov rdx, offset .L.data.189
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 46
+  lea rax, [rbp-272]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.17
+.L.begin.main.17:
+  lea rax, [rbp-264]
+  mov rdi, [rbp-272]
+  lea rax, [rax+rdi*8]
+  mov rdi, [rbp-272]
+  mov [rax], rdi
+  lea rax, [rbp-176]
+  mov rdi, [rbp-272]
+  lea rax, [rax+rdi*8]
+  push rax
+  mov rax, [rbp-272]
+  imul rax, 2
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-272]
+  push rax
+  mov rax, [rbp-272]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.17:
+  mov rax, [rbp-272]
+  mov rdi, 11
+  cmp rax, rdi
+  jl .L.begin.main.17
+  lea rax, [rbp-272]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.18
+.L.begin.main.18:
+  lea rax, [rbp-88]
+  mov rdi, [rbp-272]
+  lea rax, [rax+rdi*8]
+  push rax
+  lea rax, [rbp-176]
+  mov rdi, [rbp-272]
+  mov rax, [rax+rdi*8]
+  push rax
+  lea rax, [rbp-264]
+  mov rdi, [rbp-272]
+  mov rax, [rax+rdi*8]
+  mov rdi, rax
+  pop rax
+  sub rax, rdi
+  push rax
+  lea rax, [rbp-176]
+  mov rdi, [rbp-272]
+  mov rax, [rax+rdi*8]
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-272]
+  push rax
+  mov rax, [rbp-272]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.18:
+  mov rax, [rbp-272]
+  mov rdi, 11
+  cmp rax, rdi
+  jl .L.begin.main.18
+  lea rax, [rbp-88]
+  add rax, 80
+  mov rax, [rax]
+  push rax
+  lea rax, [rbp-88]
+  add rax, 24
+  mov rax, [rax]
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rbp-264]
+  add rax, 16
+  mov rax, [rax]
+  mov rdi, rax
+  pop rax
+  sub rax, rdi
+  mov rdi, [rbp-272]
+  add rax, rdi
+  sub rax, 2
+  mov rdx, offset .L.data.190
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  mov rax, 0
+  sub rax, 56
+  push rax
+  lea rax, [rbp-8]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.19
+.L.begin.main.19:
+  lea rax, [rbp-82]
+  mov rdi, [rbp-8]
+  lea rax, [rax+rdi*1]
+  mov rdi, 100
+  mov [rax], dil
+  lea rax, [rbp-45]
+  mov rdi, [rbp-8]
+  lea rax, [rax+rdi*1]
+  mov rdi, [rbp-8]
+  mov [rax], dil
+  lea rax, [rbp-8]
+  push rax
+  mov rax, [rbp-8]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.19:
+  mov rax, [rbp-8]
+  mov rdi, 37
+  cmp rax, rdi
+  jl .L.begin.main.19
+  lea rax, [rbp-8]
+  mov rdi, 1
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.20
+.L.begin.main.20:
+  lea rax, [rbp-45]
+  mov rdi, [rbp-8]
+  lea rax, [rax+rdi*1]
+  push rax
+  lea rax, [rbp-82]
+  mov rdi, [rbp-8]
+  movsx rax, byte ptr [rax+rdi*1]
+  push rax
+  lea rax, [rbp-82]
+  mov rdi, [rbp-8]
+  movsx rax, byte ptr [rax+rdi*1]
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  mov [rax], dil
+  lea rax, [rbp-8]
+  push rax
+  mov rax, [rbp-8]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.20:
+  mov rax, [rbp-8]
+  mov rdi, 37
+  cmp rax, rdi
+  jl .L.begin.main.20
+  lea rax, [rbp-45]
+  add rax, 36
+  movsx rax, byte ptr [rax]
+  push rax
+  lea rax, [rbp-45]
+  add rax, 0
+  movsx rax, byte ptr [rax]
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdx, offset .L.data.191
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 87
+  lea rax, [rbp-128]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.21
+.L.begin.main.21:
+  lea rax, [rbp-104]
+  mov rdi, [rbp-128]
+  lea rax, [rax+rdi*8]
+  mov rdi, [rbp-128]
+  mov [rax], rdi
+  lea rax, [rbp-128]
+  push rax
+  mov rax, [rbp-128]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.21:
+  mov rax, [rbp-128]
+  mov rdi, 13
+  cmp rax, rdi
+  jl .L.begin.main.21
+  mov rdi, 13
+  mov [rbp-120], rdi
+  mov rdi, 10
+  mov [rbp-112], rdi
+  lea rax, [rbp-128]
+  mov rdi, 2
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.22
+.L.begin.main.22:
+  lea rax, [rbp-112]
+  push rax
+  mov rax, [rbp-112]
+  push rax
+  lea rax, [rbp-104]
+  mov rdi, [rbp-128]
+  mov rax, [rax+rdi*8]
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-128]
+  push rax
+  mov rax, [rbp-128]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.22:
+  mov rax, [rbp-128]
+  mov rdi, [rbp-120]
+  cmp rax, rdi
+  jl .L.begin.main.22
+  mov rax, [rbp-112]
+  mov rdx, offset .L.data.192
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 45
+  lea rax, [rbp-104]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.23
+.L.begin.main.23:
+  lea rax, [rbp-88]
+  mov rdi, [rbp-104]
+  lea rax, [rax+rdi*8]
+  mov rdi, [rbp-104]
+  mov [rax], rdi
+  lea rax, [rbp-104]
+  push rax
+  mov rax, [rbp-104]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.23:
+  mov rax, [rbp-104]
+  mov rdi, 10
+  cmp rax, rdi
+  jl .L.begin.main.23
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-88]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rdi, 0
+  mov [rbp-96], rdi
+  lea rax, [rbp-104]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.24
+.L.begin.main.24:
+  lea rax, [rbp-96]
+  push rax
+  mov rax, [rbp-8]
+  mov rdi, [rbp-104]
+  mov rax, [rax+rdi*8]
+  mov rdi, [rbp-96]
+  add rax, rdi
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-104]
+  push rax
+  mov rax, [rbp-104]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.24:
+  mov rax, [rbp-104]
+  mov rdi, 10
+  cmp rax, rdi
+  jl .L.begin.main.24
+  mov rax, [rbp-96]
+  mov rdx, offset .L.data.193
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 22
+  lea rax, [rbp-40]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.25
+.L.begin.main.25:
+  mov rdi, [rbp-40]
+  mov rax, offset g2
+  lea rax, [rax+rdi*8]
+  push rax
+  mov rax, [rbp-40]
+  imul rax, 3
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-32]
+  mov rdi, [rbp-40]
+  lea rax, [rax+rdi*8]
+  mov rdi, [rbp-40]
+  mov [rax], rdi
+  lea rax, [rbp-40]
+  push rax
+  mov rax, [rbp-40]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.25:
+  mov rax, [rbp-40]
+  mov rdi, 4
+  cmp rax, rdi
+  jl .L.begin.main.25
+  lea rax, [rbp-40]
+  mov rdi, 0
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.26
+.L.begin.main.26:
+  mov rdi, [rbp-40]
+  mov rax, offset g2
+  lea rax, [rax+rdi*8]
+  push rax
+  mov rdi, [rbp-40]
+  mov rax, offset g2
+  mov rax, [rax+rdi*8]
+  push rax
+  lea rax, [rbp-32]
+  mov rdi, [rbp-40]
+  mov rax, [rax+rdi*8]
+  mov rdi, rax
+  pop rax
+  sub rax, rdi
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  lea rax, [rbp-40]
+  push rax
+  mov rax, [rbp-40]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.26:
+  mov rax, [rbp-40]
+  mov rdi, 4
+  cmp rax, rdi
+  jl .L.begin.main.26
+  mov rax, offset g2
+  add rax, 24
+  mov rax, [rax]
+  push rax
+  mov rax, offset g2
+  add rax, 16
+  mov rax, [rax]
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdi, [rbp-40]
+  add rax, rdi
+  push rax
+  lea rax, [rbp-32]
+  add rax, 24
+  mov rax, [rax]
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rbp-32]
+  add rax, 24
+  mov rax, [rax]
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rbp-32]
+  add rax, 16
+  mov rax, [rax]
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdx, offset .L.data.194
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 50005000
+  mov rsi, 0
+  mov rdi, 10000
+  sub rsp, 8
+  mov rax, 0
+  call sum_to
+  add rsp, 8
+  mov rdx, offset .L.data.195
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 34512
+  push 7
+  push 1
+  push 2
+  push 3
+  mov r9, 5
+  mov r8, 4
+  pop rcx
+  pop rdx
+  pop rsi
+  pop rdi
+  sub rsp, 8
+  mov rax, 0
+  call rot5
+  add rsp, 8
+  mov rdx, offset .L.data.196
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  mov rdi, 10000
+  sub rsp, 8
+  mov rax, 0
+  call is_even
+  add rsp, 8
+  mov rdx, offset .L.data.197
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  mov rdi, 10001
+  sub rsp, 8
+  mov rax, 0
+  call is_odd
+  add rsp, 8
+  mov rdx, offset .L.data.198
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 4
+  mov rdi, 3
+  sub rsp, 8
+  mov rax, 0
+  call via_ptr
+  add rsp, 8
+  mov rdx, offset .L.data.199
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 6
+  mov rdi, 5
+  sub rsp, 8
+  mov rax, 0
+  call pick
+  add rsp, 8
+  mov rdx, offset .L.data.200
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 5
+  mov rdi, 5
+  sub rsp, 8
+  mov rax, 0
+  call count_up
+  add rsp, 8
+  mov rdx, offset .L.data.201
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 6
+  mov rdi, 3
+  sub rsp, 8
+  mov rax, 0
+  call count_const
+  add rsp, 8
+  mov rdx, offset .L.data.202
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  mov rdi, 4
+  sub rsp, 8
+  mov rax, 0
+  call both_return
+  add rsp, 8
+  mov rdx, offset .L.data.203
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 2
+  mov rdi, 0
+  sub rsp, 8
+  mov rax, 0
+  call both_return
+  add rsp, 8
+  mov rdx, offset .L.data.204
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 11
+  lea rax, [rbp-32]
+  add rax, 0
+  mov rdi, 5
+  mov [rax], rdi
+  lea rax, [rbp-32]
+  add rax, 8
+  mov rdi, 6
+  mov [rax], rdi
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-32]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  mov rax, [rax]
+  push rax
+  mov rax, [rbp-8]
+  add rax, 8
+  mov rax, [rax]
+  mov rdi, rax
+  pop rax
+  add rax, rdi
+  mov rdx, offset .L.data.205
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 7
+  mov rax, offset g2
+  add rax, 0
+  mov rdi, 7
+  mov [rax], rdi
+  mov rdi, offset g2
+  mov [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, [rbp-8]
+  mov rax, [rax]
+  mov rdx, offset .L.data.206
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 9
+  lea rax, [rbp-56]
+  add rax, 24
+  add rax, 16
+  mov rdi, 9
+  mov [rax], rdi
+  lea rax, [rbp-8]
+  push rax
+  lea rax, [rbp-56]
+  add rax, 24
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  add rax, 16
+  mov rax, [rax]
+  mov rdx, offset .L.data.207
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 1
+  mov rdi, 0
+  mov [rbp-16], rdi
+  lea rax, [rbp-8]
+  push rax
+  mov rax, [rbp-16]
+  push rax
+  mov rax, 3000000000
+  mov rdi, rax
+  pop rax
+  lea rax, [rax+rdi*1]
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  mov rax, [rbp-8]
+  mov rdi, [rbp-16]
+  sub rax, rdi
+  cqo
+  mov rdi, 1
+  idiv rdi
+  push rax
+  mov rax, 3000000000
+  mov rdi, rax
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  mov rdx, offset .L.data.208
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 3
+  mov rax, 1
+  cmp rax, 0
+  je .L.else.main.27
+  lea rax, [rbp-8]
+  mov rdi, 3
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.27
+.L.else.main.27:
+  lea rax, [rbp-8]
+  mov rdi, 4
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.end.main.27:
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.209
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push 7
+  lea rax, [rbp-8]
+  mov rdi, 7
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.28
+.L.begin.main.28:
+  mov rdi, 9
+  mov [rbp-8], rdi
+  lea rax, [rbp-8]
+  push rax
+  mov rax, [rbp-8]
+  add rax, 1
+  mov rdi, rax
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+.L.cond.main.28:
+  mov rax, 0
+  cmp rax, 0
+  jne .L.begin.main.28
+  mov rax, [rbp-8]
+  mov rdx, offset .L.data.210
+  mov rsi, rax
+  pop rdi
+  mov rax, 0
+  call assert
+  push rax
+  add rsp, 8
+  mov rdi, offset .L.data.211
+  mov rax, 0
+  call printf
+  push rax
+  add rsp, 8
+  mov rax, 0
+  jmp .L.return.main
+.L.return.main:
+  mov rsp, rbp
+  pop rbp
+  ret
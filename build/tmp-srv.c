@@ -0,0 +1 @@
+int main() { int i; printf("%d %d %d", 1, 2, (i = 9)); return 0; }
@@ -0,0 +1,36 @@
+.intel_syntax noprefix
+.data
+.L.data.0:
+  .string "%d %d %d"
+.text
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-16], rbx
+  mov [rbp-24], r12
+  mov [rbp-32], r13
+  mov r10, offset .L.data.0
+  mov rbx, 2
+  lea r12, [rbp-8]
+  mov r13, 9
+  mov rax, r12
+  mov rdi, r13
+  mov [rax], rdi
+  mov rdi, r10
+  mov rsi, 1
+  mov rdx, rbx
+  mov rcx, r13
+  mov rax, 0
+  call printf
+  mov r10, rax
+  mov rax, 0
+  jmp .L.return.main
+.L.return.main:
+  mov rbx, [rbp-16]
+  mov r12, [rbp-24]
+  mov r13, [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
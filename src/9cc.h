@@ -2,16 +2,75 @@
                      // strndup関数の使用に必要なため記載。
 #include <assert.h>
 #include <ctype.h>
+#include <elf.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <setjmp.h>
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
 
 typedef struct Type Type;
 typedef struct Member Member;
 
+//
+// arena.c
+//
+
+// フェーズごとに使うバンプポインタ方式のアロケータ
+typedef struct ArenaBlock ArenaBlock;
+typedef struct {
+  char *name;
+  ArenaBlock *block;  // 現在切り出し中のブロック
+  long nobjs;         // 確保したオブジェクトの個数
+  size_t nbytes;      // 確保したバイト数
+  size_t reserved;    // ブロックとして確保済みのバイト数
+} Arena;
+
+// 翻訳単位ごとのアリーナ(TU.token_arena, TU.ast_arena)のほかに、
+// すべての翻訳単位で共有するアリーナがある。共有のアリーナはロックを取って使う
+extern Arena type_arena;    // Type
+extern Arena symbol_arena;  // Symbol
+
+void *arena_alloc(Arena *arena, size_t size);
+char *arena_strndup(Arena *arena, char *s, size_t n);
+void arena_free(Arena *arena);
+void arena_reset(Arena *arena);
+void print_mem_stats(FILE *out);
+
+//
+// symbol.c
+//
+
+// 登録(intern)済みの識別子。同じ名前のSymbolは1つしか存在しない。
+// 表はすべての翻訳単位で共有するので、番号はファイルをまたいでも一意
+typedef struct Symbol Symbol;
+struct Symbol {
+  char *name;  // '\0'終端された名前
+  int len;
+  unsigned hash;
+  int id;  // 登録順の通し番号
+};
+
+unsigned hash_bytes(char *s, int len);
+Symbol *intern(char *s, int len);
+Symbol *symbol_at(int id);
+int nsymbols(void);
+
 //
 // tokenize.c
 //
@@ -25,18 +84,18 @@ typedef enum {
   TK_EOF,  // 入力の終わりを表すトークン
 } TokenKind;
 
-// トークン型
-typedef struct Token Token;
-struct Token {
+// トークン型。配列に連続して並べるので、16バイトに収まるようにしている
+typedef struct {
   TokenKind kind;  // トークンの型
-  Token *next;     // 次の入力トークン
-  int val;         // kindがTK_NUMの場合、その数値
-  char *str;       // トークン文字列
+  int offset;      // トークン文字列のuser_inputからの位置
   int len;         // トークンの長さ
+  int aux;  // TK_NUM: 数値表の添字, TK_STR: 文字列表の添字, TK_IDENT: 識別子の番号
+} Token;
 
+typedef struct {
   char *contents;  // 終端を含む文字列リテラルの内容 '\0'
-  char cont_len;   // string literal length
-};
+  int len;         // string literal length
+} StrLit;
 
 void error(char *fmt, ...);
 void error_at(char *loc, char *fmt, ...);
@@ -46,13 +105,37 @@ Token *consume(char *op);
 Token *consume_ident(void);
 void expect(char *op);
 long expect_number(void);
-char *expect_ident(void);
+Symbol *expect_ident(void);
 bool at_eof(void);
-Token *tokenize(void);
+Token *current_token(void);
+char *token_loc(Token *tok);
+long token_val(Token *tok);
+Symbol *token_sym(Token *tok);
+char *token_contents(Token *tok);
+int token_cont_len(Token *tok);
+void line_col(int offset, int *line, int *col);
+void tokenize(void);
+int token_index(Token *tok);
+void release_tokens(void);
+
+extern bool opt_keep_going;
+extern bool opt_stream_tokens;
 
-extern char *filename;
-extern char *user_input;
-extern Token *token;
+//
+// input.c
+//
+
+char *read_file(char *path);
+
+//
+// main.c
+//
+
+extern int opt_level;
+extern int opt_jobs;
+extern bool opt_peephole;
+
+int align_to(int n, int align);
 
 //
 // parse.c
@@ -64,9 +147,11 @@ struct Var {
   char *name;     // 変数の名前
   Type *ty;       // Type
   bool is_local;  // local or global
+  bool referenced;  // 畳み込みと不要なコードの削除の後も参照されているか (-O1)
 
   // ローカル変数
-  int offset;  // RBP(ベースレジスタ)からの相対距離(オフセット)
+  int offset;       // RBP(ベースレジスタ)からの相対距離(オフセット)
+  bool addr_taken;  // &で取られたことがあるか。なければループ中はレジスタに置ける
 
   // Global variable
   char *contents;
@@ -79,6 +164,16 @@ struct VarList {
   Var *var;
 };
 
+// ブロックのスコープの木。スコープが重ならない変数は同時に生きていないので、
+// フレームの配置で同じ場所を割り当てられる
+typedef struct BlockScope BlockScope;
+struct BlockScope {
+  BlockScope *parent;
+  BlockScope *children;  // 内側のブロック。nextでつながる
+  BlockScope *next;
+  VarList *vars;  // このブロックで宣言された変数
+};
+
 // 抽象構文木のノードの種類　   (注: ptrはポインタの意)
 typedef enum {
   ND_ADD,       // num + num
@@ -88,6 +183,8 @@ typedef enum {
   ND_PTR_DIFF,  // ptr - ptr
   ND_MUL,       // *
   ND_DIV,       // /
+  ND_SHL,       // << (最適化で x * 2^k から作られる)
+  ND_NEG,       // unary - (最適化で 0 - x から作られる)
   ND_EQ,        // ==
   ND_NE,        // !=
   ND_LT,        // <
@@ -107,9 +204,13 @@ typedef enum {
   ND_VAR,        // 変数
   ND_NUM,        // Integer
   ND_NULL,       // Empty statement
+  NUM_NODE_KINDS,
 } NodeKind;
 
-// 抽象構文木のノードの型
+// 抽象構文木のノードの型。
+// 共通の部分の後ろに種類ごとのフィールドを重ねて置き、種類に必要な大きさ
+// (node_size)しか確保しない。ほかの種類のフィールドは読み書きしてはいけないので、
+// 木全体をたどるパスは子をnode_slotsで求める
 typedef struct Node Node;
 struct Node {
   NodeKind kind;  // ノードの型
@@ -117,29 +218,48 @@ struct Node {
   Type *ty;       // Type, e.g. int or pointer to int
   Token *tok;     // Representative token
 
-  Node *lhs;  // 左辺
-  Node *rhs;  // 右辺
-
-  // "if" or "while" or "for" statement
-  Node *cond;  // condition（条件)
-  Node *then;  // 条件がtrueの場合の処理
-  Node *els;
-  Node *init;  // "for"文の初期値
-  Node *inc;   // final-expression(counterなど)
-
-  // Block
-  Node *body;
-
-  // Struct member access
-  Member *member;
+  union {
+    // 式, "return", 式文
+    struct {
+      Node *lhs;  // 左辺
+      union {
+        Node *rhs;       // 右辺
+        Member *member;  // ND_MEMBER: Struct member access
+      };
+    };
+
+    // "if" or "while" or "for" statement
+    struct {
+      Node *cond;  // condition（条件)
+      Node *then;  // 条件がtrueの場合の処理
+      union {
+        Node *els;   // "if"
+        Node *init;  // "for"文の初期値
+      };
+      Node *inc;  // final-expression(counterなど)
+    };
+
+    // Block
+    struct {
+      Node *body;
+      BlockScope *scope;  // ND_BLOCK, ND_STMT_EXPRで宣言された変数
+    };
+
+    // Function call
+    struct {
+      char *funcname;
+      Node *args;
+    };
+
+    Var *var;  // ノードの型が変数の場合のみ使う
+    long val;  // kindがND_NUMの場合のみ使う
+  };
+};
 
-  // Function call
-  char *funcname;
-  Node *args;
+#define MAX_NODE_SLOTS 4  // 1つのノードが持つ子の数の最大値
 
-  Var *var;  // ノードの型が変数の場合のみ使う
-  long val;  // kindがND_NUMの場合のみ使う
-};
+size_t node_size(NodeKind kind);
+int node_slots(Node *node, Node ***slots);
 
 typedef struct Function Function;
 struct Function {
@@ -149,7 +269,12 @@ struct Function {
 
   Node *node;
   VarList *locals;
+  BlockScope *scope;  // 仮引数と最上位のローカル変数のスコープ
   int stack_size;
+
+  int tok_begin;  // 関数の定義のトークン列 [tok_begin, tok_end)
+  int tok_end;
+  unsigned long hash;  // --cache-dirのキー
 };
 
 typedef struct {
@@ -174,9 +299,15 @@ typedef enum {
 struct Type {
   TypeKind kind;
   int size;    // sizeof() value
+  int align;   // アラインメント(バイト)
   Type *base;  // アドレス先の値
   int array_len;
   Member *members;  // struct
+
+  // この型から作った派生型。同じ型は1つしか作らないので、ポインタで比べられる
+  Type *ptr_to;      // この型へのポインタ
+  Type *arrays;      // この型の配列。要素数ごとにnext_arrayでつながる
+  Type *next_array;
 };
 
 // Struct member
@@ -191,12 +322,379 @@ extern Type *char_type;
 extern Type *int_type;
 
 bool is_integer(Type *ty);
+Type *new_type(TypeKind kind, int size, int align);
 Type *pointer_to(Type *base);
 Type *array_of(Type *base, int len);
+void reset_types(void);
 void add_type(Node *node);
 
+//
+// optimize.c
+//
+
+void optimize(Program *prog);
+
+//
+// layout.c
+//
+
+void layout_frame(Function *fn);
+
+//
+// inline.c
+//
+
+// 呼び出しごとのインライン展開の判断
+typedef enum {
+  INL_DONE,          // 展開した
+  INL_UNDEFINED,     // 関数の定義がない
+  INL_NOT_LEAF,      // 関数を呼び出している(再帰も含む)
+  INL_TOO_LARGE,     // -finline-limitより大きい
+  INL_NO_RETURN,     // 最上位にreturnがない
+  INL_EARLY_RETURN,  // 最後の文以外にreturnがある
+  INL_ARGS,          // 引数の個数が仮引数と合わない
+  NUM_INLINE_DECISIONS,
+} InlineDecision;
+
+extern int opt_inline_limit;
+
+void inline_functions(Program *prog);
+
+//
+// stats.c
+//
+
+// 計測するフェーズ
+typedef enum {
+  PH_READ,
+  PH_TOKENIZE,
+  PH_PARSE,
+  PH_OPTIMIZE,
+  PH_LAYOUT,  // ローカル変数のオフセットの割り当て
+  PH_CODEGEN,
+  NUM_PHASES,
+} Phase;
+
+typedef struct {
+  double wall;  // 秒
+  double cpu;
+} Time;
+
+// 翻訳単位のコンパイル中に測る時間と数えるカウンタ
+typedef struct {
+  Time phase_time[NUM_PHASES];
+  long phase_rss[NUM_PHASES];  // フェーズ終了時点の最大RSS(KB)
+  Time phase_start;
+  int cur_phase;  // 計測中のフェーズ。-1なら計測していない
+
+  long nodes[NUM_NODE_KINDS];  // パーサが作ったノードの種類ごとの個数
+  long var_lookups;            // find_varの呼び出し回数
+  long var_probes;             // そのときのハッシュ表の探索回数の合計
+  long max_var_probe;
+  long inline_sites[NUM_INLINE_DECISIONS];  // 判断ごとの呼び出し箇所の数
+  long cache_hits;                          // --cache-dirから読めた関数の数
+  long cache_misses;
+  long vec_loops;  // ベクトル化したループの数
+  long tail_calls;  // callの代わりにjmpにした呼び出しの数
+  long dead_stmts;  // 到達しないので取り除いた文の数
+  long dead_vars;   // 参照されないので取り除いたローカル変数と文字列リテラルの数
+
+  // 命令の種類ごとの個数。Symbolの番号で引く
+  long *insn_counts;
+  int insn_cap;
+  Symbol **mnemonics;
+  int nmnemonics;
+} Stats;
+
+extern bool collect_stats;  // 出力する命令を数えるか
+
+void use_thread_cpu_time(void);
+void start_phase(Phase ph);
+void end_phase(void);
+void count_insns(char *s, size_t len);
+void print_stats(FILE *out, bool counters, bool json);
+
+//
+// emit.c
+//
+
+// 伸長可能な出力バッファ
+typedef struct {
+  char *data;
+  size_t len;
+  size_t cap;
+} Buf;
+
+extern _Thread_local Buf *emit_buf;  // emit()の書き込み先。スレッドごとに持つ
+
+void buf_write(Buf *buf, char *s, size_t len);
+void emit(char *fmt, ...);
+void open_output(void);
+void close_output(void);
+void write_all(int fd, char *data, size_t len);
+void flush_output(bool force);
+void output_buf(Buf *buf);
+
+// 書式指定のない文字列リテラルの出力。長さはコンパイル時に決まるので走査もしない
+#define emit_lit(s) buf_write(emit_buf, s, sizeof(s) - 1)
+
+//
+// cache.c
+//
+
+extern char *cache_dir;        // --cache-dir。NULLならファイルに保存しない
+extern bool cache_in_memory;  // --server: メモリにもキャッシュする
+
+bool cache_enabled(void);
+
+unsigned long hash_tokens(int begin, int end);
+void hash_functions(Program *prog);
+bool cache_load(Function *fn, Buf *out);
+void cache_store(Function *fn, Buf *buf);
+
+//
+// elf.c
+//
+
+void assemble(char *src, size_t len, Buf *out);
+bool parse_reg(char *s, int len, int *reg, int *size);
+
+//
+// peephole.c
+//
+
+void peephole(Buf *buf);
+
 //
 // codegen.c
 //
 
+// 関数1つ分のコード生成の状態。関数ごとに別々に持つので、
+// 複数の関数を別々のスレッドで同時に生成できる
+typedef struct {
+  Function *fn;
+  Buf out;             // この関数のアセンブリ
+  int labelseq;        // ラベルの通し番号。ラベルには関数名も入るので関数内で一意ならよい
+  bool cached;         // outをキャッシュから読んだので生成しない
+  int depth;           // スタックマシンが積んでいる8バイト値の個数(-O0)
+  bool frame_escapes;  // ローカル変数のアドレスが呼び出し先に渡りうる
+  Node **loops;        // -finstrument: 番号順に並べた関数のループ
+  int nloops;
+  long vec_loops;      // ベクトル化したループの数。出力するときにtuの計測結果に足す
+  long tail_calls;     // callの代わりにjmpにした呼び出しの数。同上
+} GenCtx;
+
+extern _Thread_local GenCtx *gen_ctx;  // このスレッドが生成中の関数
+
+extern bool opt_tail_calls;  // -f[no-]optimize-sibling-calls
+
+char *cond_cc(NodeKind kind, bool neg);
+bool is_tail_call(Node *node);
 void codegen(Program *prog);
+
+//
+// profile.c
+//
+
+extern bool opt_instrument;  // -finstrument
+
+Node **function_loops(Function *fn, int *nloops);
+void emit_entry_count(void);
+int loop_id(Node *loop);
+void emit_loop_count(int id);
+void emit_profile_data(Program *prog);
+void emit_profile_text(Program *prog);
+
+//
+// vectorize.c
+//
+
+#define MAX_VEC_ARRAYS 5  // ベクトル化するループで参照できる配列の数
+
+// ベクトル化できるループの内容
+typedef struct {
+  Node *expr;  // 要素ごとの式
+  Var *dest;   // 式の値を代入する配列。NULLならリダクション
+  Var *sum;    // リダクションで足し込む変数
+  Type *elem;  // 配列の要素の型(intかchar)
+  Node *bound;  // 帰納変数の上限
+  Var *arrays[MAX_VEC_ARRAYS];  // 参照する配列(リダクションならポインタも)
+  int narrays;
+} VecLoop;
+
+extern bool opt_vectorize;
+extern bool opt_avx2;
+
+bool match_vec_loop(Node *node, Var *iv, VecLoop *vl);
+void emit_vec_loop(VecLoop *vl, char **bases, char *funcname, int seq);
+
+//
+// ir.c
+//
+
+// 中間表現(IR)の命令の種類。値はすべて仮想レジスタ(1以上の番号)で受け渡す
+typedef enum {
+  IR_IMM,       // d = imm
+  IR_ADD,       // d = a + b
+  IR_SUB,       // d = a - b
+  IR_MUL,       // d = a * b
+  IR_DIV,       // d = a / b
+  IR_SHL,       // d = a << imm
+  IR_MOV,       // d = a
+  IR_LEA,       // d = a + b * imm (immは1, 2, 4, 8)
+  IR_NEG,       // d = -a
+  IR_EQ,        // d = a == b
+  IR_NE,        // d = a != b
+  IR_LT,        // d = a < b
+  IR_LE,        // d = a <= b
+  IR_LVAR,      // d = ローカル変数varのアドレス
+  IR_GVAR,      // d = グローバル変数varのアドレス
+  IR_LOAD,      // d = *a  (sizeバイト)
+  IR_STORE,     // *a = b  (sizeバイト)
+  IR_LABEL,     // ラベル
+  IR_JMP,       // 無条件ジャンプ
+  IR_BCMP,      // aとb(0ならimm)を比べてccが成り立てばジャンプ
+  IR_CALL,      // d = funcname(args...)
+  IR_TAILCALL,  // return funcname(args...)。フレームを片付けてからjmpする
+  IR_RET,       // return a
+  IR_KEEP,      // argsをここまで生かしておく。何も出力しない
+  IR_COUNT,     // -finstrument: labelの番号のループのカウンタに1を足す
+  IR_VLOOP,     // ベクトル化したループ。aは帰納変数、bは上限、argsは配列のアドレス、
+                // dはリダクションの部分和の合計
+} IROp;
+
+typedef struct IR IR;
+struct IR {
+  IROp op;
+  int d;  // 結果を受け取る仮想レジスタ
+  int a;
+  int b;     // 0の場合、二項演算ではbの代わりにimmを使う
+  long imm;
+  int size;  // IR_LOAD, IR_STORE のアクセスサイズ
+
+  // IR_LABEL, IR_JMP, IR_BCMP
+  char *lname;  // ラベルの種類 (e.g. "begin")
+  int label;
+  char *cc;  // IR_BCMP の条件コード (e.g. "le")
+
+  Var *var;  // IR_LVAR, IR_GVAR
+
+  // IR_CALL
+  char *funcname;
+  int args[6];  // IR_KEEP, IR_VLOOPでも使う
+  int nargs;
+
+  VecLoop *vloop;  // IR_VLOOP
+};
+
+typedef struct {
+  Function *fn;
+  IR *ins;  // 命令列
+  int len;
+  int cap;
+  int nvreg;  // 使用する仮想レジスタの個数(番号は1から)
+
+  // レジスタ割り当ての結果 (regalloc.c)
+  int *reg;    // 仮想レジスタ -> 物理レジスタの番号。スピルした場合は-1
+  int *spill;  // スピルした仮想レジスタのRBPからのオフセット
+  int frame_size;
+  int callee_saved[8];  // 保存・復元が必要な物理レジスタの番号
+  int nsaved;
+} IRFunc;
+
+void gen_ir(Function *fn);
+void reset_ir(void);
+
+//
+// regalloc.c
+//
+
+extern char *regs[];
+bool is_callee_saved(int r);
+void alloc_regs(IRFunc *f);
+
+//
+// driver.c
+//
+
+// 翻訳単位(入力ファイル1つ)をコンパイルする間の状態。ファイルごとに別々に
+// 持つので、複数のファイルを別々のスレッドで同時にコンパイルできる
+typedef struct {
+  char *filename;
+  char *user_input;      // 入力プログラム
+  size_t input_map_len;  // user_inputをmmapした領域の大きさ (input.c)
+  bool input_malloced;   // user_inputをmallocで確保した
+  char *out_path;        // 出力先。"-"は標準出力、NULLならoutに溜めたまま残す
+  bool object;           // アセンブリの代わりにオブジェクトファイルを書き出す
+  int jobs;              // コード生成に使うスレッドの数
+
+  // 字句解析 (token.c)
+  Token *tokens;          // トークン列。先頭はtok_base番目のトークン
+  int ntokens;            // これまでに読んだトークンの数
+  int tokens_cap;
+  int tok_base;
+  Token *old_tokens[32];  // --stream-tokens: 伸ばす前のトークン列の領域
+  int nold_tokens;
+  int tok_pos;            // 現在着目しているトークンの添字
+  int lex_pos;            // 次に字句解析を始める入力の位置。読み終えたら-1
+  long *num_tab;  // TK_NUM, TK_STR の値は別の表に置き、トークンからは添字で参照する
+  int num_len;
+  int num_cap;
+  StrLit *str_tab;
+  int str_len;
+  int str_cap;
+  int *lines;  // 各行の先頭の位置
+  int nlines;
+  int lines_cap;
+
+  // エラー (token.c)
+  int nerrors;
+  jmp_buf *recover;  // --keep-going: エラーの後に解析を続ける回復点
+  jmp_buf *fatal;    // --server: 致命的なエラーで要求を打ち切る戻り先
+
+  // 構文解析 (parse.c)
+  VarList *locals;  // 解析中の関数のローカル変数
+  VarList *globals;
+  BlockScope *block;  // 解析中の最も内側のブロック
+  struct ScopeSlot *scope_tab;
+  int scope_cap;
+  int scope_used;
+  struct VarScope *scope;  // 宣言した順に積まれた変数のスタック
+  int label_seq;           // 文字列リテラルのラベルの通し番号
+
+  Arena token_arena;  // 文字列リテラルの内容
+  Arena ast_arena;    // Node, Var, VarList, Function, Member。
+                      // --stream-tokensでは構文木が指すトークンも置く
+
+  // 出力 (emit.c)
+  Buf out;
+  int out_fd;
+
+  Stats stats;
+} TU;
+
+extern _Thread_local TU *tu;  // このスレッドがコンパイル中の翻訳単位
+
+TU *new_tu(char *filename, char *out_path, bool object);
+void reset_tu(TU *t);
+void free_tu(TU *t);
+void free_old_tokens(TU *t);  // token.c
+void free_input(TU *t);       // input.c
+void compile_all(TU **tus, int ntus, int jobs, void (*compile)(TU *t));
+
+//
+// server.c
+//
+
+// --serverが受け取った要求
+typedef struct {
+  char *cwd;    // クライアントの作業ディレクトリ
+  char **argv;  // コマンドライン引数。argv[0]はプログラム名
+  int argc;
+  char *input;     // 入力ファイルが"-"のときのソース
+  Buf *out;        // 返す出力
+  char *out_path;  // クライアントが出力を書き出す先。"-"は標準出力
+} Request;
+
+void serve(char *path, int (*handle)(Request *req));
+int connect_server(char *path, int argc, char **argv);
@@ -0,0 +1,103 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// バンプポインタ方式のアロケータ。
+// 大きなブロックを確保しておき、その中からポインタを進めるだけで切り出す。
+// オブジェクトは個別には解放しない。翻訳単位のアリーナは、その翻訳単位の
+// コンパイルが終わったところでブロックごとまとめて解放する。
+// --serverでは解放せずに空に戻し、次の要求で同じブロックを使い回す。
+//
+
+#define ARENA_BLOCK_SIZE (1024 * 1024)
+#define ARENA_ALIGN 8
+
+struct ArenaBlock {
+  ArenaBlock *next;
+  size_t size;
+  size_t used;
+  char data[];
+};
+
+Arena type_arena = {"type"};
+Arena symbol_arena = {"symbol"};
+
+static ArenaBlock *new_block(Arena *arena, size_t size) {
+  if (size < ARENA_BLOCK_SIZE) size = ARENA_BLOCK_SIZE;
+
+  // callocは大きな領域をmmapで確保するので、ゼロ埋めのコストはほぼかからない
+  ArenaBlock *blk = calloc(1, sizeof(ArenaBlock) + size);
+  if (!blk) error("%s arena: out of memory", arena->name);
+  blk->size = size;
+  blk->next = arena->block;
+  arena->block = blk;
+  arena->reserved += size;
+  return blk;
+}
+
+// ゼロで初期化されたsizeバイトの領域を返す
+void *arena_alloc(Arena *arena, size_t size) {
+  size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+
+  ArenaBlock *blk = arena->block;
+  if (!blk || blk->size - blk->used < size) blk = new_block(arena, size);
+
+  void *p = blk->data + blk->used;
+  blk->used += size;
+  arena->nobjs++;
+  arena->nbytes += size;
+  return p;
+}
+
+char *arena_strndup(Arena *arena, char *s, size_t n) {
+  char *p = arena_alloc(arena, n + 1);
+  memcpy(p, s, n);
+  return p;
+}
+
+// ブロックをすべて解放する。使用量の記録はそのまま残す
+void arena_free(Arena *arena) {
+  while (arena->block) {
+    ArenaBlock *next = arena->block->next;
+    free(arena->block);
+    arena->block = next;
+  }
+}
+
+// 最も新しいブロックだけを残して空に戻す。arena_allocはゼロで埋まった領域を
+// 返すので、使った部分はゼロで埋め直す
+void arena_reset(Arena *arena) {
+  ArenaBlock *blk = arena->block;
+  if (!blk) return;
+
+  while (blk->next) {
+    ArenaBlock *next = blk->next->next;
+    free(blk->next);
+    blk->next = next;
+  }
+  memset(blk->data, 0, blk->used);
+  blk->used = 0;
+  arena->nobjs = 0;
+  arena->nbytes = 0;
+  arena->reserved = blk->size;
+}
+
+// 翻訳単位のアリーナと共有のアリーナの使用量を出力する (--mem-stats)
+void print_mem_stats(FILE *out) {
+  Arena *arenas[] = {&tu->token_arena, &tu->ast_arena, &type_arena,
+                     &symbol_arena};
+
+  fprintf(out, "%-8s %12s %14s %14s\n", "arena", "objects", "bytes",
+          "reserved");
+  for (int i = 0; i < sizeof(arenas) / sizeof(*arenas); i++) {
+    Arena *a = arenas[i];
+    fprintf(out, "%-8s %12ld %14zu %14zu\n", a->name, a->nobjs, a->nbytes,
+            a->reserved);
+  }
+
+  // トークン列はアリーナではなく、伸長可能な配列に置いている。
+  // --stream-tokensでは、bytesは残っているトークンの分だけになる
+  fprintf(out, "%-8s %12d %14zu %14zu\n", "tokens", tu->ntokens,
+          (tu->ntokens - tu->tok_base) * sizeof(Token),
+          tu->tokens_cap * sizeof(Token));
+}
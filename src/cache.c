@@ -0,0 +1,286 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// 関数ごとのアセンブリのキャッシュ (--cache-dir)。
+// 関数のトークン列と、参照するグローバル変数(型と初期値を含む)、
+// 呼び出す関数のトークン列(インライン展開されうるため)、コード生成に
+// 効くオプションからキーを計算し、<dir>/<キー>.s に生成結果を保存する。
+// キーが一致すれば、その関数のコード生成とpeepholeを省いてファイルの内容を
+// 使う。-cのときも同じアセンブリから最後にまとめてオブジェクトを作る。
+// キャッシュの読み書きに失敗しても、普通に生成するだけでエラーにはしない。
+// --serverでは、同じキーで一度生成したアセンブリをメモリにも置いておく。
+// サーバは要求を1つずつ処理するので、メモリのキャッシュにロックは要らない。
+//
+
+char *cache_dir;
+bool cache_in_memory;
+
+// メモリのキャッシュに置く関数の数の上限。超えたらすべて捨てる
+#define MEM_CACHE_MAX 65536
+
+// 64ビットのFNV-1a
+#define FNV_OFFSET 14695981039346656037ul
+#define FNV_PRIME 1099511628211ul
+
+// 形式を変えたら上げる
+#define CACHE_VERSION 1
+
+static unsigned long mix(unsigned long h, void *p, size_t len) {
+  unsigned char *s = p;
+  for (size_t i = 0; i < len; i++) {
+    h ^= s[i];
+    h *= FNV_PRIME;
+  }
+  return h;
+}
+
+static unsigned long mix_long(unsigned long h, long val) {
+  return mix(h, &val, sizeof(val));
+}
+
+static unsigned long mix_str(unsigned long h, char *s) {
+  return mix(h, s, strlen(s) + 1);
+}
+
+// 型を構造ごと混ぜる。グローバル変数の構造体はトークン列の外で宣言されている
+static unsigned long mix_type(unsigned long h, Type *ty) {
+  h = mix_long(h, ty->kind);
+  h = mix_long(h, ty->size);
+  h = mix_long(h, ty->align);
+  h = mix_long(h, ty->array_len);
+  if (ty->base) h = mix_type(h, ty->base);
+  for (Member *mem = ty->members; mem; mem = mem->next) {
+    h = mix_str(h, mem->name);
+    h = mix_long(h, mem->offset);
+    h = mix_type(h, mem->ty);
+  }
+  return h;
+}
+
+static unsigned long mix_refs(unsigned long h, Node *node);
+
+static unsigned long mix_refs_list(unsigned long h, Node *node) {
+  for (Node *n = node; n; n = n->next) h = mix_refs(h, n);
+  return h;
+}
+
+// 部分木が参照するグローバル変数を混ぜる
+static unsigned long mix_refs(unsigned long h, Node *node) {
+  Node **slots[MAX_NODE_SLOTS];
+  int nslots = node_slots(node, slots);
+  for (int i = 0; i < nslots; i++) h = mix_refs_list(h, *slots[i]);
+
+  if (node->kind == ND_VAR && !node->var->is_local) {
+    Var *var = node->var;
+    h = mix_str(h, var->name);
+    h = mix_type(h, var->ty);
+    h = mix_long(h, var->cont_len);
+    if (var->contents) h = mix(h, var->contents, var->cont_len);
+  }
+  return h;
+}
+
+// トークン列 [begin, end) のキー。--stream-tokensではトークンが残らないので、
+// パーサが関数を読み終えたところで求める
+unsigned long hash_tokens(int begin, int end) {
+  unsigned long h = FNV_OFFSET;
+  for (int i = begin; i < end; i++) {
+    Token *tok = &tu->tokens[i - tu->tok_base];
+    h = mix_long(h, tok->kind);
+    h = mix_long(h, tok->len);
+    h = mix(h, token_loc(tok), tok->len);
+  }
+  return h;
+}
+
+// 関数自身のトークン列のキーに、参照するグローバル変数を混ぜる
+static unsigned long own_hash(Function *fn) {
+  return mix_refs_list(fn->hash, fn->node);
+}
+
+static unsigned long mix_callees(unsigned long h, Node *node,
+                                 Function **fns) {
+  for (; node; node = node->next) {
+    Node **slots[MAX_NODE_SLOTS];
+    int nslots = node_slots(node, slots);
+    for (int i = 0; i < nslots; i++) h = mix_callees(h, *slots[i], fns);
+
+    if (node->kind == ND_FUNCALL) {
+      Function *fn = fns[intern(node->funcname, strlen(node->funcname))->id];
+      h = mix_long(h, fn ? fn->hash : 0);
+    }
+  }
+  return h;
+}
+
+// すべての関数のキーを求める。インライン展開より前に呼ぶ
+void hash_functions(Program *prog) {
+  Function **fns = calloc(nsymbols(), sizeof(Function *));
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    fn->hash = own_hash(fn);
+    fns[intern(fn->name, strlen(fn->name))->id] = fn;
+  }
+
+  // 呼び出す関数のキーが先に書き換わらないよう、別の配列に求めてから戻す
+  int nfns = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next) nfns++;
+  unsigned long *keys = calloc(nfns, sizeof(long));
+  int i = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    unsigned long h = mix_long(fn->hash, CACHE_VERSION);
+    h = mix_long(h, opt_level);
+    h = mix_long(h, opt_peephole);
+    h = mix_long(h, opt_inline_limit);
+    h = mix_long(h, opt_vectorize);
+    h = mix_long(h, opt_avx2);
+    h = mix_long(h, opt_tail_calls);
+    h = mix_long(h, opt_instrument);
+    keys[i++] = mix_callees(h, fn->node, fns);
+  }
+
+  i = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next) fn->hash = keys[i++];
+  free(keys);
+  free(fns);
+}
+
+bool cache_enabled(void) { return cache_dir || cache_in_memory; }
+
+// メモリのキャッシュ。キーで引くオープンアドレス法のハッシュ表
+typedef struct {
+  unsigned long key;
+  Buf buf;  // dataがNULLなら空き
+} MemEntry;
+
+static MemEntry *mem_tab;
+static int mem_cap;
+static int mem_used;
+
+static MemEntry *mem_find(MemEntry *tab, int cap, unsigned long key) {
+  int i = key & (cap - 1);
+  while (tab[i].buf.data && tab[i].key != key) i = (i + 1) & (cap - 1);
+  return &tab[i];
+}
+
+static void mem_insert(unsigned long key, Buf *buf) {
+  if (mem_used == MEM_CACHE_MAX) {
+    for (int i = 0; i < mem_cap; i++) free(mem_tab[i].buf.data);
+    memset(mem_tab, 0, sizeof(MemEntry) * mem_cap);
+    mem_used = 0;
+  }
+
+  if (mem_used * 2 >= mem_cap) {
+    int cap = mem_cap ? mem_cap * 2 : 1024;
+    MemEntry *tab = calloc(cap, sizeof(MemEntry));
+    for (int i = 0; i < mem_cap; i++)
+      if (mem_tab[i].buf.data)
+        *mem_find(tab, cap, mem_tab[i].key) = mem_tab[i];
+    free(mem_tab);
+    mem_tab = tab;
+    mem_cap = cap;
+  }
+
+  MemEntry *e = mem_find(mem_tab, mem_cap, key);
+  if (e->buf.data) return;
+  e->key = key;
+  e->buf.data = malloc(buf->len + 1);  // 空の出力でもNULLにしない
+  e->buf.len = e->buf.cap = buf->len;
+  memcpy(e->buf.data, buf->data, buf->len);
+  mem_used++;
+}
+
+static bool mem_load(unsigned long key, Buf *out) {
+  if (!mem_cap) return false;
+  MemEntry *e = mem_find(mem_tab, mem_cap, key);
+  if (!e->buf.data) return false;
+  buf_write(out, e->buf.data, e->buf.len);
+  return true;
+}
+
+static char *cache_path(Function *fn, char *suffix) {
+  char *path = malloc(strlen(cache_dir) + 40);
+  sprintf(path, "%s/%016lx.s%s", cache_dir, fn->hash, suffix);
+  return path;
+}
+
+// キャッシュのファイルがあればoutに読み込んでtrueを返す
+static bool file_load(Function *fn, Buf *out) {
+  char *path = cache_path(fn, "");
+  int fd = open(path, O_RDONLY);
+  free(path);
+
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) < 0) {
+    if (fd >= 0) close(fd);
+    return false;
+  }
+
+  // outは空のバッファ
+  out->data = malloc(st.st_size + 1);
+  out->cap = st.st_size + 1;
+  out->len = 0;
+  while (out->len < st.st_size) {
+    ssize_t n = read(fd, out->data + out->len, st.st_size - out->len);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) break;
+    out->len += n;
+  }
+  close(fd);
+
+  if (out->len != st.st_size) {
+    out->len = 0;
+    return false;
+  }
+  return true;
+}
+
+// キャッシュがあればoutに読み込んでtrueを返す
+bool cache_load(Function *fn, Buf *out) {
+  bool hit = cache_in_memory && mem_load(fn->hash, out);
+  if (!hit && cache_dir && file_load(fn, out)) {
+    hit = true;
+    if (cache_in_memory) mem_insert(fn->hash, out);
+  }
+
+  if (hit)
+    tu->stats.cache_hits++;
+  else
+    tu->stats.cache_misses++;
+  return hit;
+}
+
+// 一時ファイルの名前の通し番号。同じ関数を持つ翻訳単位を同時に保存しても重ならない
+static atomic_int tmp_seq;
+
+// 生成したアセンブリを保存する。別の9ccと同時に書いても壊れないよう、
+// 一時ファイルに書いてから名前を変える
+void cache_store(Function *fn, Buf *buf) {
+  if (cache_in_memory) mem_insert(fn->hash, buf);
+  if (!cache_dir) return;
+  mkdir(cache_dir, 0777);
+
+  char suffix[32];
+  sprintf(suffix, ".%d.%d.tmp", getpid(), atomic_fetch_add(&tmp_seq, 1));
+  char *tmp = cache_path(fn, suffix);
+  char *path = cache_path(fn, "");
+
+  int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (fd >= 0) {
+    char *p = buf->data;
+    size_t len = buf->len;
+    while (len > 0) {
+      ssize_t n = write(fd, p, len);
+      if (n < 0 && errno == EINTR) continue;
+      if (n <= 0) break;
+      p += n;
+      len -= n;
+    }
+    close(fd);
+
+    if (len > 0 || rename(tmp, path) < 0) unlink(tmp);
+  }
+
+  free(tmp);
+  free(path);
+}
@@ -9,12 +9,42 @@ static char *argreg1[] = {"dil", "sil", "dl", "cl", "r8b", "r9b"};
 // 8byte用 第一引数、第二引数、第三引数…と順に続く配列
 static char *argreg8[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
 
-// ユニークなアセンブラのラベルを生成するための変数
-static int labelseq = 1;
-static char *funcname;
+_Thread_local GenCtx *gen_ctx;
+
+bool opt_tail_calls;  // -foptimize-sibling-calls/-fno-optimize-sibling-calls
 
 static void gen(Node *node);
 
+// スタックマシンのpush/popはすべてここを通し、積んだ個数を数える。
+// フレームは16バイト境界に揃えてあるので、個数の偶奇だけでcall時の
+// RSPの揃い方が静的にわかる
+static void push(char *opd) {
+  emit("  push %s\n", opd);
+  gen_ctx->depth++;
+}
+
+// pushの即値は符号付き32ビットなので、収まらない値はraxを経由する
+static void push_imm(long val) {
+  if (val == (int)val) {
+    emit("  push %ld\n", val);
+  } else {
+    emit("  mov rax, %ld\n", val);
+    emit_lit("  push rax\n");
+  }
+  gen_ctx->depth++;
+}
+
+static void pop(char *reg) {
+  emit("  pop %s\n", reg);
+  gen_ctx->depth--;
+}
+
+// 積んだ値を1つ捨てる
+static void drop(void) {
+  emit_lit("  add rsp, 8\n");
+  gen_ctx->depth--;
+}
+
 /* 与えられたノードの変数のオフセット分だけメモリを確保し、そのアドレスをスタックに積む関数
  */
 static void gen_addr(Node *node) {
@@ -23,10 +53,11 @@ static void gen_addr(Node *node) {
       Var *var = node->var;
       if (var->is_local) {
         // アドレス計算 lea命令
-        printf("  lea rax, [rbp-%d]\n", var->offset);
-        printf("  push rax\n");
+        emit("  lea rax, [rbp-%d]\n", var->offset);
+        push("rax");
       } else {
-        printf("  push offset %s\n", var->name);
+        emit("  push offset %s\n", var->name);
+        gen_ctx->depth++;
       }
       return;
     }
@@ -35,9 +66,9 @@ static void gen_addr(Node *node) {
       return;
     case ND_MEMBER:
       gen_addr(node->lhs);
-      printf("  pop rax\n");
-      printf("  add rax, %d\n", node->member->offset);
-      printf("  push rax\n");
+      pop("rax");
+      emit("  add rax, %d\n", node->member->offset);
+      push("rax");
       return;
   }
 
@@ -50,37 +81,125 @@ static void gen_lval(Node *node) {
 }
 
 static void load(Type *ty) {
-  printf("  pop rax\n");
+  pop("rax");
   if (ty->size == 1)
-    printf("  movsx rax, byte ptr [rax]\n");
+    emit_lit("  movsx rax, byte ptr [rax]\n");
   else
-    printf("  mov rax, [rax]\n");
-  printf("  push rax\n");
+    emit_lit("  mov rax, [rax]\n");
+  push("rax");
 }
 
 static void store(Type *ty) {
-  printf("  pop rdi\n");
-  printf("  pop rax\n");
+  pop("rdi");
+  pop("rax");
 
   if (ty->size == 1)
-    printf("  mov [rax], dil\n");
+    emit_lit("  mov [rax], dil\n");
   else
-    printf("  mov [rax], rdi\n");
+    emit_lit("  mov [rax], rdi\n");
+
+  push("rdi");
+}
+
+// 比較演算子の条件コード。negなら条件が成り立たないときのもの
+char *cond_cc(NodeKind kind, bool neg) {
+  switch (kind) {
+    case ND_EQ:
+      return neg ? "ne" : "e";
+    case ND_NE:
+      return neg ? "e" : "ne";
+    case ND_LT:
+      return neg ? "ge" : "l";
+    case ND_LE:
+      return neg ? "g" : "le";
+  }
+  return NULL;
+}
 
-  printf("  push rdi\n");
+// `return f(...)`の呼び出しを、フレームを片付けてからのjmpにできるか。
+// 呼び出し先はこのフレームを上書きするので、ローカル変数のアドレスが
+// 渡りうる関数では行わない
+bool is_tail_call(Node *node) {
+  if (!opt_tail_calls || gen_ctx->frame_escapes || node->kind != ND_RETURN ||
+      node->lhs->kind != ND_FUNCALL)
+    return false;
+
+  int nargs = 0;
+  for (Node *arg = node->lhs->args; arg; arg = arg->next) nargs++;
+  return nargs <= 6;
+}
+
+// 自分自身を末尾で呼び出すか
+static bool has_self_tail_call(Node *node) {
+  for (; node; node = node->next) {
+    if (is_tail_call(node) && !strcmp(node->lhs->funcname, gen_ctx->fn->name))
+      return true;
+    Node **slots[MAX_NODE_SLOTS];
+    int nslots = node_slots(node, slots);
+    for (int i = 0; i < nslots; i++)
+      if (has_self_tail_call(*slots[i])) return true;
+  }
+  return false;
+}
+
+// return f(...)。引数をレジスタに移してから、自分自身ならプロローグの後ろへ、
+// そうでなければフレームを片付けて呼び出し先へジャンプする。
+// 戻り先は元の呼び出し元のままなので、呼び出し先のretがそこへ直接戻る
+static void gen_tail_call(Node *node) {
+  char *funcname = gen_ctx->fn->name;
+  int nargs = 0;
+  for (Node *arg = node->args; arg; arg = arg->next) {
+    gen(arg);
+    nargs++;
+  }
+  for (int i = nargs - 1; i >= 0; i--) pop(argreg8[i]);
+
+  // 積んでいる値はフレームごと捨てる
+  emit_lit("  mov rsp, rbp\n");
+  if (!strcmp(node->funcname, funcname)) {
+    emit("  jmp .L.tail.%s\n", funcname);
+  } else {
+    emit_lit("  pop rbp\n");
+    emit_lit("  mov rax, 0\n");
+    emit("  jmp %s\n", node->funcname);
+  }
+  gen_ctx->tail_calls++;
+}
+
+// condの真偽がjump_ifと等しければラベルへジャンプする。
+// 比較演算子なら0/1の値を作らず、cmpの結果で直接ジャンプする
+static void gen_branch(Node *cond, bool jump_if, char *lname, int seq) {
+  char *funcname = gen_ctx->fn->name;
+  char *cc = cond_cc(cond->kind, !jump_if);
+
+  if (cc) {
+    gen(cond->lhs);
+    gen(cond->rhs);
+    pop("rdi");
+    pop("rax");
+    emit_lit("  cmp rax, rdi\n");
+  } else {
+    gen(cond);
+    pop("rax");
+    emit_lit("  cmp rax, 0\n");
+    cc = jump_if ? "ne" : "e";
+  }
+  emit("  j%s .L.%s.%s.%d\n", cc, lname, funcname, seq);
 }
 
 /* スタックマシンライクな構文木からのアセンブリ出力関数 */
 void gen(Node *node) {
+  char *funcname = gen_ctx->fn->name;
+
   switch (node->kind) {
     case ND_NULL:
       return;
     case ND_NUM:
-      printf("  push %ld\n", node->val);
+      push_imm(node->val);
       return;
     case ND_EXPR_STMT:
       gen(node->lhs);
-      printf("  add rsp, 8\n");
+      drop();
       return;
     case ND_VAR:
     case ND_MEMBER:
@@ -100,55 +219,38 @@ void gen(Node *node) {
       if (node->ty->kind != TY_ARRAY) load(node->ty);
       return;
     case ND_IF: {
-      int seq = labelseq++;
+      int seq = gen_ctx->labelseq++;
       if (node->els) {
-        gen(node->cond);
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
-        printf("  je  .L.else.%d\n", seq);
+        gen_branch(node->cond, false, "else", seq);
         gen(node->then);
-        printf("  jmp .L.end.%d\n", seq);
-        printf(".L.else.%d:\n", seq);
+        emit("  jmp .L.end.%s.%d\n", funcname, seq);
+        emit(".L.else.%s.%d:\n", funcname, seq);
         gen(node->els);
-        printf(".L.end.%d:\n", seq);
+        emit(".L.end.%s.%d:\n", funcname, seq);
       } else {
-        gen(node->cond);
-        printf("  pop rax\n");
-        printf(
-            "  cmp rax, 0\n");  // if条件がfalse(0)の場合、if文から外れる(goto
-                                // end)
-        printf("  je  .L.end.%d\n", seq);
+        // if条件がfalse(0)の場合、if文から外れる(goto end)
+        gen_branch(node->cond, false, "end", seq);
         gen(node->then);
-        printf(".L.end.%d:\n", seq);
+        emit(".L.end.%s.%d:\n", funcname, seq);
       }
       return;
     }
-    case ND_WHILE: {
-      int seq = labelseq++;
-      printf(".L.begin.%d:\n", seq);
-      gen(node->cond);
-      printf("  pop rax\n");
-      printf("  cmp rax, 0\n");
-      printf("  je  .L.end.%d\n", seq);
-      gen(node->then);
-      printf("  jmp .L.begin.%d\n", seq);
-      printf(".L.end.%d:\n", seq);
-      return;
-    }
+    case ND_WHILE:
     case ND_FOR: {
-      int seq = labelseq++;
+      // 条件を末尾に置き、1回の繰り返しで分岐が1回だけ成立するようにする。
+      // 最初は条件の判定へ飛び込む
+      int seq = gen_ctx->labelseq++;
       if (node->init) gen(node->init);
-      printf(".L.begin.%d:\n", seq);
-      if (node->cond) {
-        gen(node->cond);
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
-        printf("  je  .L.end.%d\n", seq);
-      }
+      emit("  jmp .L.cond.%s.%d\n", funcname, seq);
+      emit(".L.begin.%s.%d:\n", funcname, seq);
+      if (opt_instrument) emit_loop_count(loop_id(node));
       gen(node->then);
       if (node->inc) gen(node->inc);
-      printf("  jmp .L.begin.%d\n", seq);
-      printf(".L.end.%d:\n", seq);
+      emit(".L.cond.%s.%d:\n", funcname, seq);
+      if (node->cond)
+        gen_branch(node->cond, true, "begin", seq);
+      else
+        emit("  jmp .L.begin.%s.%d\n", funcname, seq);
       return;
     }
     case ND_BLOCK:
@@ -164,114 +266,153 @@ void gen(Node *node) {
 
       // 配列のindexは0から始まるので-1する
       for (int i = nargs - 1; i >= 0; i--) {
-        printf("  pop %s\n", argreg8[i]);
+        pop(argreg8[i]);
       }
 
       // 関数を呼び出す前に RSP を 16 バイト境界に揃える必要があります。これは
       // ABI の要求です。 可変長の関数では RAX を 0 に設定します。
-
-      // アセンブララベル名のインデックス
-      int seq = labelseq++;
-      printf("  mov rax, rsp\n");
-      // 15の2進数は`1111`。これを論理積しても値は変化しない。
-      printf("  and rax, 15\n");  //
-
-      // ? jnzがcmp命令なしで動作する理由が不明
-      printf("  jnz .L.call.%d\n", seq);  // 16バイトの場合
-      printf("  mov rax, 0\n");
-      printf("  call %s\n", node->funcname);
-      printf("  jmp .L.end.%d\n", seq);
-
-      printf(".L.call.%d:\n", seq);  // 8バイトの場合、
-      printf("  sub rsp, 8\n");      // 8を引いて16の倍数にしてから
-      printf("  mov rax, 0\n");
-      printf("  call %s\n", node->funcname);  // 関数呼び出し。
-      printf("  add rsp, 8\n");
-      printf(".L.end.%d:\n", seq);
-      printf("  push rax\n");
+      // 積んでいる値が奇数個なら8バイトずれているので、8を引いて揃える
+      bool pad = gen_ctx->depth & 1;
+      if (pad) emit_lit("  sub rsp, 8\n");
+      emit_lit("  mov rax, 0\n");
+      emit("  call %s\n", node->funcname);
+      if (pad) emit_lit("  add rsp, 8\n");
+      push("rax");
       return;
     }
+    case ND_NEG:
+      gen(node->lhs);
+      pop("rax");
+      emit_lit("  neg rax\n");
+      push("rax");
+      return;
+    case ND_SHL:
+      gen(node->lhs);
+      pop("rax");
+      emit("  shl rax, %ld\n", node->rhs->val);
+      push("rax");
+      return;
+    case ND_PTR_ADD:
+      // 定数の加算はスケール済みの即値1つにまとめる。
+      // addの即値は符号付き32ビットなので、収まらなければ汎用の経路に任せる
+      if (node->rhs->kind == ND_NUM) {
+        long imm = node->rhs->val * node->ty->base->size;
+        if (imm == (int)imm) {
+          gen(node->lhs);
+          pop("rax");
+          emit("  add rax, %ld\n", imm);
+          push("rax");
+          return;
+        }
+      }
+      break;
     case ND_RETURN:
+      if (is_tail_call(node)) {
+        gen_tail_call(node->lhs);
+        return;
+      }
       gen(node->lhs);
-      printf("  pop rax\n");
+      pop("rax");
       // JMP命令: 無条件に指定した場所に移動する
-      printf("  jmp .L.return.%s\n", funcname);
+      emit("  jmp .L.return.%s\n", funcname);
       return;
   }
 
   gen(node->lhs);
   gen(node->rhs);
 
-  printf("  pop rdi\n");
-  printf("  pop rax\n");
+  pop("rdi");
+  pop("rax");
 
   switch (node->kind) {
     case ND_ADD:
-      printf("  add rax, rdi\n");
+      emit_lit("  add rax, rdi\n");
       break;
-    case ND_PTR_ADD:
-      printf("  imul rdi, %d\n", node->ty->base->size);
-      printf("  add rax, rdi\n");
+    case ND_PTR_ADD: {
+      // 要素の大きさが1, 2, 4, 8ならアドレッシングモードで掛ける
+      int size = node->ty->base->size;
+      if (size == 1 || size == 2 || size == 4 || size == 8) {
+        emit("  lea rax, [rax+rdi*%d]\n", size);
+      } else {
+        emit("  imul rdi, %d\n", size);
+        emit_lit("  add rax, rdi\n");
+      }
       break;
+    }
     case ND_SUB:
-      printf("  sub rax, rdi\n");
+      emit_lit("  sub rax, rdi\n");
       break;
     case ND_PTR_SUB:
-      printf("  imul rdi, %d\n", node->ty->base->size);
-      printf("  sub rax, rdi\n");
+      emit("  imul rdi, %d\n", node->ty->base->size);
+      emit_lit("  sub rax, rdi\n");
       break;
     case ND_PTR_DIFF:
-      printf("  sub rax, rdi\n");
-      printf("  cqo\n");
-      printf("  mov rdi, %d\n", node->lhs->ty->base->size);
-      printf("  idiv rdi\n");
+      emit_lit("  sub rax, rdi\n");
+      emit_lit("  cqo\n");
+      emit("  mov rdi, %d\n", node->lhs->ty->base->size);
+      emit_lit("  idiv rdi\n");
       break;
     case ND_MUL:
-      printf("  imul rax, rdi\n");
+      emit_lit("  imul rax, rdi\n");
       break;
     case ND_DIV:
-      printf("  cqo\n");
-      printf("  idiv rdi\n");
+      emit_lit("  cqo\n");
+      emit_lit("  idiv rdi\n");
       break;
     case ND_EQ:
-      printf("  cmp rax, rdi\n");
-      printf("  sete al\n");
-      printf("  movzb rax, al\n");
+      emit_lit("  cmp rax, rdi\n");
+      emit_lit("  sete al\n");
+      emit_lit("  movzb rax, al\n");
       break;
     case ND_NE:
-      printf("  cmp rax, rdi\n");
-      printf("  setne al\n");
-      printf("  movzb rax, al\n");
+      emit_lit("  cmp rax, rdi\n");
+      emit_lit("  setne al\n");
+      emit_lit("  movzb rax, al\n");
       break;
     case ND_LT:
-      printf("  cmp rax, rdi\n");
-      printf("  setl al\n");
-      printf("  movzb rax, al\n");
+      emit_lit("  cmp rax, rdi\n");
+      emit_lit("  setl al\n");
+      emit_lit("  movzb rax, al\n");
       break;
     case ND_LE:
-      printf("  cmp rax, rdi\n");
-      printf("  setle al\n");
-      printf("  movzb rax, al\n");
+      emit_lit("  cmp rax, rdi\n");
+      emit_lit("  setle al\n");
+      emit_lit("  movzb rax, al\n");
       break;
   }
 
-  printf("  push rax\n");
+  push("rax");
 }
 
 static void emit_data(Program *prog) {
-  printf(".data\n");
+  emit_lit(".data\n");
+  if (opt_instrument && prog->fns) emit_profile_data(prog);
 
   for (VarList *vl = prog->globals; vl; vl = vl->next) {
     Var *var = vl->var;
-    printf("%s:\n", var->name);
+    emit("%s:\n", var->name);
 
     if (!var->contents) {
-      printf("  .zero %d\n", var->ty->size);
+      emit("  .zero %d\n", var->ty->size);
       continue;
     }
 
-    for (int i = 0; i < var->cont_len; i++)
-      printf("  .byte %d\n", var->contents[i]);
+    // 最後の'\0'は.stringが付け加えるので、その手前までを出力する
+    emit_lit("  .string \"");
+    for (int i = 0; i < var->cont_len - 1; i++) {
+      unsigned char c = var->contents[i];
+      if (c == '"' || c == '\\') {
+        char esc[2] = {'\\', c};
+        buf_write(emit_buf, esc, 2);
+      } else if (' ' <= c && c <= '~') {
+        buf_write(emit_buf, (char *)&c, 1);
+      } else {
+        char esc[4] = {'\\', '0' + (c >> 6), '0' + ((c >> 3) & 7),
+                       '0' + (c & 7)};
+        buf_write(emit_buf, esc, 4);
+      }
+    }
+    emit_lit("\"\n");
   }
 }
 
@@ -280,47 +421,143 @@ static void emit_data(Program *prog) {
 static void load_arg(Var *var, int idx) {
   int sz = var->ty->size;
   if (sz == 1) {
-    printf("  mov [rbp-%d], %s\n", var->offset, argreg1[idx]);
+    emit("  mov [rbp-%d], %s\n", var->offset, argreg1[idx]);
   } else {
     assert(sz == 8);
-    printf("  mov [rbp-%d], %s\n", var->offset, argreg8[idx]);
+    emit("  mov [rbp-%d], %s\n", var->offset, argreg8[idx]);
   }
 }
 
+// スタックマシンで関数のプロローグからエピローグまでを出力する
+static void gen_function(Function *fn) {
+  // Prologue
+  emit_lit("  push rbp\n");
+  emit_lit("  mov rbp, rsp\n");
+  // 自分自身の末尾呼び出しは、RSPをRBPに戻してからここへ戻ってくる
+  if (has_self_tail_call(fn->node)) emit(".L.tail.%s:\n", fn->name);
+  // push rbpの直後のRSPは16の倍数なので、フレームも16の倍数にする
+  emit("  sub rsp, %d\n", align_to(fn->stack_size, 16));
+
+  // Push arguments to the stack
+  int i = 0;
+  for (VarList *vl = fn->params; vl; vl = vl->next) {
+    load_arg(vl->var, i++);
+  }
+  if (opt_instrument) emit_entry_count();
+
+  // Emit code
+  for (Node *node = fn->node; node; node = node->next) {
+    gen(node);
+  }
+  assert(gen_ctx->depth == 0);
+
+  // Epilogue
+  emit(".L.return.%s:\n", fn->name);
+  emit_lit("  mov rsp, rbp\n");
+  emit_lit("  pop rbp\n");
+  emit_lit("  ret\n");
+}
+
+// 関数1つ分のアセンブリをctx->outに生成する
+static void gen_fn(GenCtx *ctx) {
+  Buf *buf = emit_buf;
+  gen_ctx = ctx;
+  emit_buf = &ctx->out;
+
+  Function *fn = ctx->fn;
+  for (VarList *vl = fn->locals; vl; vl = vl->next) {
+    TypeKind kind = vl->var->ty->kind;
+    if (vl->var->addr_taken || kind == TY_ARRAY || kind == TY_STRUCT)
+      ctx->frame_escapes = true;
+  }
+  if (opt_instrument) ctx->loops = function_loops(fn, &ctx->nloops);
+
+  emit(".global %s\n", fn->name);
+  emit("%s:\n", fn->name);
+
+  // -O1以上ではIRに変換してレジスタ割り当てを行う
+  if (opt_level >= 1)
+    gen_ir(fn);
+  else
+    gen_function(fn);
+
+  if (opt_peephole) peephole(&ctx->out);
+  free(ctx->loops);
+
+  emit_buf = buf;
+  gen_ctx = NULL;
+}
+
+// スレッドプールで共有する作業。次に生成する関数の番号を取り合う
+typedef struct {
+  TU *tu;
+  GenCtx *ctxs;
+  int nfns;
+  atomic_int next;
+} GenWork;
+
+static void *gen_worker(void *arg) {
+  GenWork *work = arg;
+  tu = work->tu;
+  for (;;) {
+    int i = atomic_fetch_add(&work->next, 1);
+    if (i >= work->nfns) return NULL;
+    if (!work->ctxs[i].cached) gen_fn(&work->ctxs[i]);
+  }
+}
+
+// 生成した関数1つを出力する。-jでもスレッドがすべて終わってから呼ぶので、
+// 関数ごとの計測結果はここでtuに足せば競合しない
+static void output_fn(GenCtx *ctx) {
+  if (cache_enabled() && !ctx->cached) cache_store(ctx->fn, &ctx->out);
+  output_buf(&ctx->out);
+  free(ctx->out.data);
+  tu->stats.vec_loops += ctx->vec_loops;
+  tu->stats.tail_calls += ctx->tail_calls;
+}
+
 static void emit_text(Program *prog) {
-  printf(".text\n");
+  emit_lit(".text\n");
+
+  int nfns = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next) nfns++;
 
+  GenCtx *ctxs = calloc(nfns, sizeof(GenCtx));
+  int i = 0;
   for (Function *fn = prog->fns; fn; fn = fn->next) {
-    printf(".global %s\n", fn->name);
-    printf("%s:\n", fn->name);
-    funcname = fn->name;
-
-    // Prologue
-    printf("  push rbp\n");
-    printf("  mov rbp, rsp\n");
-    printf("  sub rsp, %d\n", fn->stack_size);
-
-    // Push arguments to the stack
-    int i = 0;
-    for (VarList *vl = fn->params; vl; vl = vl->next) {
-      load_arg(vl->var, i++);
-    }
+    ctxs[i].fn = fn;
+    ctxs[i].cached = cache_enabled() && cache_load(fn, &ctxs[i].out);
+    ctxs[i++].labelseq = 1;
+  }
 
-    // Emit code
-    for (Node *node = fn->node; node; node = node->next) {
-      gen(node);
+  // 1スレッドなら、生成したそばから出力してメモリを解放する
+  if (tu->jobs <= 1 || nfns <= 1) {
+    for (int i = 0; i < nfns; i++) {
+      if (!ctxs[i].cached) gen_fn(&ctxs[i]);
+      output_fn(&ctxs[i]);
     }
-
-    // Epilogue
-    printf(".L.return.%s:\n", funcname);
-    printf("  mov rsp, rbp\n");
-    printf("  pop rbp\n");
-    printf("  ret\n");
+    free(ctxs);
+    return;
   }
+
+  GenWork work = {tu, ctxs, nfns};
+  int nthreads = tu->jobs < nfns ? tu->jobs : nfns;
+  pthread_t *threads = calloc(nthreads, sizeof(pthread_t));
+  for (int i = 0; i < nthreads; i++)
+    if (pthread_create(&threads[i], NULL, gen_worker, &work))
+      error("cannot create thread: %s", strerror(errno));
+  for (int i = 0; i < nthreads; i++) pthread_join(threads[i], NULL);
+
+  // どのスレッドが生成したかによらず、元の順番で出力する
+  for (int i = 0; i < nfns; i++) output_fn(&ctxs[i]);
+  free(threads);
+  free(ctxs);
 }
 
 void codegen(Program *prog) {
-  printf(".intel_syntax noprefix\n");
+  emit_lit(".intel_syntax noprefix\n");
   emit_data(prog);
   emit_text(prog);
+  if (opt_instrument && prog->fns) emit_profile_text(prog);
+  flush_output(true);
 }
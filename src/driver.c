@@ -0,0 +1,120 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// 翻訳単位(入力ファイル1つ)の状態と、複数のファイルを1つのプロセスで
+// コンパイルするドライバ。
+// 字句解析器とパーサの状態、ASTのアリーナ、出力先、計測結果はTUにまとめてあり、
+// コンパイル中のスレッドのtuが指す。複数のファイルはスレッドプールで同時に
+// コンパイルし、各スレッドは次のファイルの番号を取り合う。
+// 識別子の表と型はすべての翻訳単位で共有するので、symbol.cとtype.cが
+// ロックで守る。
+//
+
+_Thread_local TU *tu;
+
+TU *new_tu(char *filename, char *out_path, bool object) {
+  TU *t = calloc(1, sizeof(TU));
+  t->filename = filename;
+  t->out_path = out_path;
+  t->object = object;
+  t->jobs = 1;
+  t->token_arena.name = "token";
+  t->ast_arena.name = "ast";
+  t->stats.cur_phase = -1;
+  return t;
+}
+
+// 翻訳単位を空に戻し、次の入力のコンパイルに使い回す(--server)。
+// アリーナのブロックと、トークン列などの伸長する配列の領域は解放せずに残す
+void reset_tu(TU *t) {
+  free_input(t);
+  free_old_tokens(t);
+  free(t->scope_tab);
+  free(t->stats.insn_counts);
+  free(t->stats.mnemonics);
+  arena_reset(&t->token_arena);
+  arena_reset(&t->ast_arena);
+
+  TU old = *t;
+  *t = (TU){
+      .jobs = 1,
+      .tokens = old.tokens,
+      .tokens_cap = old.tokens_cap,
+      .num_tab = old.num_tab,
+      .num_cap = old.num_cap,
+      .str_tab = old.str_tab,
+      .str_cap = old.str_cap,
+      .lines = old.lines,
+      .lines_cap = old.lines_cap,
+      .token_arena = old.token_arena,
+      .ast_arena = old.ast_arena,
+      .out = {old.out.data, 0, old.out.cap},
+  };
+  t->stats.cur_phase = -1;
+}
+
+// コンパイルを終えた翻訳単位のメモリを解放する
+void free_tu(TU *t) {
+  free_input(t);
+  free_old_tokens(t);
+  free(t->tokens);
+  free(t->num_tab);
+  free(t->str_tab);
+  free(t->lines);
+  free(t->scope_tab);
+  free(t->out.data);
+  free(t->stats.insn_counts);
+  free(t->stats.mnemonics);
+  arena_free(&t->token_arena);
+  arena_free(&t->ast_arena);
+  free(t);
+}
+
+// スレッドプールで共有する作業。次にコンパイルする翻訳単位の番号を取り合う
+typedef struct {
+  TU **tus;
+  int ntus;
+  void (*compile)(TU *t);
+  atomic_int next;
+} Work;
+
+static void *worker(void *arg) {
+  Work *work = arg;
+  for (;;) {
+    int i = atomic_fetch_add(&work->next, 1);
+    if (i >= work->ntus) return NULL;
+    tu = work->tus[i];
+    work->compile(tu);
+    free_tu(tu);
+    tu = NULL;
+  }
+}
+
+// すべての翻訳単位をcompileでコンパイルする。jobsはスレッドの数で、
+// ファイルが1つならその関数のコード生成に、複数ならファイルの並列化に使う
+void compile_all(TU **tus, int ntus, int jobs, void (*compile)(TU *t)) {
+  if (ntus == 1) {
+    tu = tus[0];
+    tu->jobs = jobs;
+    compile(tu);
+    free_tu(tu);
+    tu = NULL;
+    return;
+  }
+
+  Work work = {tus, ntus, compile};
+  int nthreads = jobs < ntus ? jobs : ntus;
+  if (nthreads <= 1) {
+    worker(&work);
+    return;
+  }
+
+  use_thread_cpu_time();
+  pthread_t *threads = calloc(nthreads, sizeof(pthread_t));
+  for (int i = 0; i < nthreads; i++)
+    if (pthread_create(&threads[i], NULL, worker, &work))
+      error("cannot create thread: %s", strerror(errno));
+  for (int i = 0; i < nthreads; i++) pthread_join(threads[i], NULL);
+  free(threads);
+}
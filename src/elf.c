@@ -0,0 +1,1007 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// 外部のアセンブラを使わずに、9ccが出力したアセンブリを
+// ELF64の再配置可能オブジェクト(.o)に変換する(-c)。
+// 対応するのはcodegen.cとir.c、vectorize.cが出力する命令と疑似命令だけである。
+// .L.で始まるラベルへのジャンプはここで解決し、
+// 関数呼び出しとグローバル変数のアドレスは再配置としてリンカに任せる。
+//
+
+enum { SEC_UNDEF, SEC_TEXT, SEC_DATA };
+
+typedef struct {
+  Symbol *name;
+  int section;  // 定義されているセクション。未定義ならSEC_UNDEF
+  long value;   // セクション先頭からのオフセット
+  bool global;
+  int index;  // シンボルテーブルでの番号
+} AsmSym;
+
+typedef enum {
+  FIX_JUMP,   // jmp, jcc: ローカルなラベルなら自前で解決する
+  FIX_CALL,   // call: ローカルなラベルなら自前で解決し、それ以外はリンカに任せる
+  FIX_ABS32,  // offset: 符号拡張される32ビットの絶対アドレス
+} FixKind;
+
+typedef struct {
+  FixKind kind;
+  long offset;  // .text内で値を書き込む位置
+  AsmSym *sym;
+} Fixup;
+
+typedef enum { OP_REG, OP_MEM, OP_IMM, OP_SYM, OP_OFFSET } OperandKind;
+
+typedef struct {
+  OperandKind kind;
+  int reg;     // OP_REG
+  int size;    // OP_REG, OP_MEM: オペランドのバイト数。xmmは16、ymmは32
+  int base;    // OP_MEM
+  int index;   // OP_MEM: なければ-1
+  int scale;   // OP_MEM
+  long disp;   // OP_MEM
+  long imm;    // OP_IMM
+  AsmSym *sym; // OP_SYM, OP_OFFSET
+} Operand;
+
+// 変換中の状態。翻訳単位ごとに別々のスレッドで変換できるよう、スレッドごとに持つ
+static _Thread_local Buf text;
+static _Thread_local Buf data;
+static _Thread_local int cur_section;
+
+static _Thread_local AsmSym **syms;  // Symbolの番号から引く表
+static _Thread_local int syms_cap;
+static _Thread_local AsmSym **sym_list;  // 出現順
+static _Thread_local int nsyms;
+
+static _Thread_local Fixup *fixups;
+static _Thread_local int nfixups;
+static _Thread_local int fixups_cap;
+
+static _Thread_local char *line_start;  // エラー表示用
+static _Thread_local int line_len;
+
+static void asm_error(char *msg) {
+  error("assembler: %s: %.*s", msg, line_len, line_start);
+}
+
+static AsmSym *get_sym(char *s, int len) {
+  Symbol *name = intern(s, len);
+  if (name->id >= syms_cap) {
+    int cap = syms_cap ? syms_cap : 256;
+    while (cap <= name->id) cap *= 2;
+    syms = realloc(syms, sizeof(AsmSym *) * cap);
+    memset(syms + syms_cap, 0, sizeof(AsmSym *) * (cap - syms_cap));
+    syms_cap = cap;
+  }
+
+  if (!syms[name->id]) {
+    AsmSym *sym = calloc(1, sizeof(AsmSym));
+    sym->name = name;
+    syms[name->id] = sym;
+    sym_list = realloc(sym_list, sizeof(AsmSym *) * (nsyms + 1));
+    sym_list[nsyms++] = sym;
+  }
+  return syms[name->id];
+}
+
+static bool is_local_label(AsmSym *sym) {
+  return sym->name->len > 2 && !strncmp(sym->name->name, ".L", 2);
+}
+
+static Buf *section_buf(void) {
+  if (cur_section == SEC_TEXT) return &text;
+  if (cur_section == SEC_DATA) return &data;
+  asm_error("no section");
+  return NULL;
+}
+
+static void out8(int c) {
+  char b = c;
+  buf_write(&text, &b, 1);
+}
+
+static void out32(long v) {
+  for (int i = 0; i < 4; i++) out8(v >> (i * 8));
+}
+
+static void out64(long v) {
+  for (int i = 0; i < 8; i++) out8(v >> (i * 8));
+}
+
+static void add_fixup(FixKind kind, AsmSym *sym) {
+  if (nfixups == fixups_cap) {
+    fixups_cap = fixups_cap ? fixups_cap * 2 : 256;
+    fixups = realloc(fixups, sizeof(Fixup) * fixups_cap);
+  }
+  fixups[nfixups++] = (Fixup){kind, text.len, sym};
+}
+
+static bool is_imm8(long v) { return -128 <= v && v <= 127; }
+static bool is_imm32(long v) { return INT_MIN <= v && v <= INT_MAX; }
+
+// jmpとjccを出力する。ccが-1ならjmp。
+// 後方へのジャンプは行き先が分かっているので、届くなら2バイトの形式にする
+static void encode_jump(int cc, AsmSym *sym) {
+  if (sym->section == SEC_TEXT && !sym->global) {
+    long rel = sym->value - (text.len + 2);
+    if (is_imm8(rel)) {
+      out8(cc < 0 ? 0xeb : 0x70 + cc);
+      out8(rel);
+      return;
+    }
+  }
+
+  if (cc < 0) {
+    out8(0xe9);
+  } else {
+    out8(0x0f);
+    out8(0x80 + cc);
+  }
+  add_fixup(FIX_JUMP, sym);
+  out32(0);
+}
+
+//
+// オペランドの解析
+//
+
+static char *reg64[] = {"rax", "rcx", "rdx", "rbx", "rsp", "rbp",
+                        "rsi", "rdi", "r8",  "r9",  "r10", "r11",
+                        "r12", "r13", "r14", "r15"};
+static char *reg8[] = {"al",  "cl",  "dl",   "bl",   "spl",  "bpl",
+                       "sil", "dil", "r8b",  "r9b",  "r10b", "r11b",
+                       "r12b", "r13b", "r14b", "r15b"};
+
+static bool equal(char *s, int len, char *name) {
+  return strlen(name) == len && !strncmp(s, name, len);
+}
+
+// レジスタ名なら、その番号(raxが0、r15が15)とバイト数を返す
+bool parse_reg(char *s, int len, int *reg, int *size) {
+  for (int i = 0; i < 16; i++) {
+    if (equal(s, len, reg64[i])) {
+      *reg = i;
+      *size = 8;
+      return true;
+    }
+    if (equal(s, len, reg8[i])) {
+      *reg = i;
+      *size = 1;
+      return true;
+    }
+  }
+  return false;
+}
+
+// xmm0-xmm15, ymm0-ymm15
+static bool parse_vec_reg(char *s, int len, int *reg, int *size) {
+  if (len < 4 || len > 5 || (strncmp(s, "xmm", 3) && strncmp(s, "ymm", 3)))
+    return false;
+  int n = 0;
+  for (int i = 3; i < len; i++) {
+    if (!isdigit(s[i])) return false;
+    n = n * 10 + s[i] - '0';
+  }
+  if (n > 15) return false;
+  *reg = n;
+  *size = s[0] == 'x' ? 16 : 32;
+  return true;
+}
+
+static long parse_num(char *s, int len) {
+  char *end;
+  long val = strtol(s, &end, 0);
+  if (end != s + len) asm_error("invalid number");
+  return val;
+}
+
+static char *skip_space(char *p, char *end) {
+  while (p < end && (*p == ' ' || *p == '\t')) p++;
+  return p;
+}
+
+// [base+index*scale+disp] の形式のメモリオペランド
+static void parse_mem(Operand *op, char *p, char *end) {
+  if (*p != '[' || end[-1] != ']') asm_error("invalid memory operand");
+  p++;
+  end--;
+
+  op->kind = OP_MEM;
+  op->base = -1;
+  op->index = -1;
+  op->scale = 1;
+
+  while (p < end) {
+    int sign = 1;
+    if (*p == '+' || *p == '-') {
+      sign = *p == '-' ? -1 : 1;
+      p++;
+    }
+
+    char *q = p;
+    while (q < end && *q != '+' && *q != '-') q++;
+
+    char *star = memchr(p, '*', q - p);
+    int reg, size;
+    if (star) {
+      if (!parse_reg(p, star - p, &reg, &size) || size != 8 || sign < 0)
+        asm_error("invalid index register");
+      op->index = reg;
+      op->scale = parse_num(star + 1, q - star - 1);
+    } else if (parse_reg(p, q - p, &reg, &size)) {
+      if (size != 8 || sign < 0) asm_error("invalid base register");
+      if (op->base < 0)
+        op->base = reg;
+      else
+        op->index = reg;
+    } else {
+      op->disp += sign * parse_num(p, q - p);
+    }
+    p = q;
+  }
+
+  if (op->base < 0) asm_error("memory operand without base register");
+  if (op->index == 4) asm_error("rsp cannot be an index register");
+  if (op->scale != 1 && op->scale != 2 && op->scale != 4 && op->scale != 8)
+    asm_error("invalid scale");
+}
+
+static void parse_operand(Operand *op, char *p, char *end) {
+  *op = (Operand){};
+
+  if (end - p > 9 && !strncmp(p, "byte ptr ", 9)) {
+    parse_mem(op, skip_space(p + 9, end), end);
+    op->size = 1;
+    return;
+  }
+  if (end - p > 10 && !strncmp(p, "qword ptr ", 10)) {
+    parse_mem(op, skip_space(p + 10, end), end);
+    op->size = 8;
+    return;
+  }
+  if (*p == '[') {
+    parse_mem(op, p, end);
+    return;
+  }
+
+  if (end - p > 7 && !strncmp(p, "offset ", 7)) {
+    p = skip_space(p + 7, end);
+    op->kind = OP_OFFSET;
+    op->sym = get_sym(p, end - p);
+    return;
+  }
+
+  if (parse_reg(p, end - p, &op->reg, &op->size) ||
+      parse_vec_reg(p, end - p, &op->reg, &op->size)) {
+    op->kind = OP_REG;
+    return;
+  }
+
+  if (*p == '-' || isdigit(*p)) {
+    op->kind = OP_IMM;
+    op->imm = parse_num(p, end - p);
+    return;
+  }
+
+  op->kind = OP_SYM;
+  op->sym = get_sym(p, end - p);
+}
+
+//
+// 命令の符号化
+//
+
+// ModR/M(とSIB、ディスプレースメント)を出力する
+static void encode_modrm(int reg, Operand *rm) {
+  reg &= 7;
+  if (rm->kind == OP_REG) {
+    out8(0xc0 | (reg << 3) | (rm->reg & 7));
+    return;
+  }
+
+  // rbpとr13はディスプレースメントなしでは符号化できない
+  int mod;
+  if (rm->disp == 0 && (rm->base & 7) != 5)
+    mod = 0;
+  else if (is_imm8(rm->disp))
+    mod = 1;
+  else if (is_imm32(rm->disp))
+    mod = 2;
+  else
+    asm_error("displacement out of range");
+
+  // rspとr12をベースにする場合とインデックスを使う場合はSIBバイトが必要
+  if (rm->index >= 0 || (rm->base & 7) == 4) {
+    int index = rm->index >= 0 ? rm->index & 7 : 4;
+    int ss = rm->scale == 8 ? 3 : rm->scale == 4 ? 2 : rm->scale == 2 ? 1 : 0;
+    out8((mod << 6) | (reg << 3) | 4);
+    out8((ss << 6) | (index << 3) | (rm->base & 7));
+  } else {
+    out8((mod << 6) | (reg << 3) | (rm->base & 7));
+  }
+
+  if (mod == 1) out8(rm->disp);
+  if (mod == 2) out32(rm->disp);
+}
+
+// REXプレフィックス、オペコード、ModR/M(とSIB、ディスプレースメント)を出力する。
+// regはModR/Mのregフィールドに入るレジスタ番号か拡張オペコード
+static void encode(bool w, char *opcode, int oplen, int reg, Operand *rm,
+                   bool byte_reg) {
+  int rex = w ? 8 : 0;
+  if (reg & 8) rex |= 4;
+  if (rm->kind == OP_REG) {
+    if (rm->reg & 8) rex |= 1;
+  } else {
+    if (rm->index >= 0 && (rm->index & 8)) rex |= 2;
+    if (rm->base & 8) rex |= 1;
+  }
+
+  // spl, bpl, sil, dilはREXプレフィックスがないとah, ch, dh, bhになってしまう
+  bool need_rex = rex != 0;
+  if (byte_reg && ((4 <= reg && reg <= 7) ||
+                   (rm->kind == OP_REG && rm->size == 1 && 4 <= rm->reg &&
+                    rm->reg <= 7)))
+    need_rex = true;
+  if (need_rex) out8(0x40 | rex);
+
+  for (int i = 0; i < oplen; i++) out8(opcode[i]);
+  encode_modrm(reg, rm);
+}
+
+static void encode1(bool w, int opcode, int reg, Operand *rm) {
+  char op = opcode;
+  encode(w, &op, 1, reg, rm, false);
+}
+
+static void encode2(bool w, int opcode, int reg, Operand *rm) {
+  char op[] = {0x0f, opcode};
+  encode(w, op, 2, reg, rm, false);
+}
+
+// SSEの命令。前置きのバイト(0x66など)はREXプレフィックスより前に置く
+static void encode_sse(int prefix, bool w, int opcode, int reg, Operand *rm) {
+  out8(prefix);
+  encode2(w, opcode, reg, rm);
+}
+
+// 3バイトのVEXプレフィックスを使うAVXの命令。
+// ppは前置きのバイトの種類(1なら0x66、2なら0xf3)、mapはオペコード表
+// (1なら0x0f、3なら0x0f 0x3a)、vvvvは2つ目のソースレジスタ
+static void encode_vex(int pp, int map, bool l, int vvvv, int opcode, int reg,
+                       Operand *rm) {
+  bool x = rm->kind == OP_MEM && rm->index >= 0 && (rm->index & 8);
+  bool b = rm->kind == OP_REG ? rm->reg & 8 : rm->base & 8;
+  out8(0xc4);
+  out8(((reg & 8) ? 0 : 0x80) | (x ? 0 : 0x40) | (b ? 0 : 0x20) | map);
+  out8(((~vvvv & 15) << 3) | (l ? 4 : 0) | pp);
+  out8(opcode);
+  encode_modrm(reg, rm);
+}
+
+static bool is_reg64(Operand *op) { return op->kind == OP_REG && op->size == 8; }
+static bool is_rm64(Operand *op) {
+  return is_reg64(op) || (op->kind == OP_MEM && op->size != 1);
+}
+static bool is_rm8(Operand *op) {
+  return op->kind == OP_REG ? op->size == 1 : op->kind == OP_MEM;
+}
+static bool is_xmm(Operand *op) { return op->kind == OP_REG && op->size == 16; }
+static bool is_ymm(Operand *op) { return op->kind == OP_REG && op->size == 32; }
+static bool is_vec(Operand *op) { return is_xmm(op) || is_ymm(op); }
+
+// 条件コード。jccとsetccで共通
+static int cond_code(char *s, int len) {
+  static char *names[] = {"o",  "no", "b",  "ae", "e", "ne", "be", "a",
+                          "s",  "ns", "p",  "np", "l", "ge", "le", "g"};
+  for (int i = 0; i < 16; i++)
+    if (equal(s, len, names[i])) return i;
+  if (equal(s, len, "z")) return 4;
+  if (equal(s, len, "nz")) return 5;
+  if (equal(s, len, "c")) return 2;
+  if (equal(s, len, "nc")) return 3;
+  return -1;
+}
+
+// 算術演算の種類。ModR/Mのregフィールドに入る拡張オペコードにもなる
+static int alu_code(char *s, int len) {
+  static char *names[] = {"add", "or", "adc", "sbb", "and", "sub", "xor",
+                          "cmp"};
+  for (int i = 0; i < 8; i++)
+    if (equal(s, len, names[i])) return i;
+  return -1;
+}
+
+// SSE2の整数演算のオペコード。AVXではvを付けた3オペランドの形になる
+static int sse_opcode(char *s, int len) {
+  static char *names[] = {"paddb", "paddq", "psubb", "psubq", "pxor"};
+  static int opcodes[] = {0xfc, 0xd4, 0xf8, 0xfb, 0xef};
+  for (int i = 0; i < 5; i++)
+    if (equal(s, len, names[i])) return opcodes[i];
+  return -1;
+}
+
+static void encode_alu(int code, Operand *dst, Operand *src) {
+  if (is_rm64(dst) && is_reg64(src)) {
+    encode1(true, code * 8 + 1, src->reg, dst);
+    return;
+  }
+  if (is_reg64(dst) && is_rm64(src)) {
+    encode1(true, code * 8 + 3, dst->reg, src);
+    return;
+  }
+  if (is_rm64(dst) && src->kind == OP_IMM) {
+    if (is_imm8(src->imm)) {
+      encode1(true, 0x83, code, dst);
+      out8(src->imm);
+      return;
+    }
+    if (is_imm32(src->imm)) {
+      encode1(true, 0x81, code, dst);
+      out32(src->imm);
+      return;
+    }
+  }
+  asm_error("invalid operands");
+}
+
+static void encode_mov(Operand *dst, Operand *src) {
+  if (is_rm64(dst) && is_reg64(src)) {
+    encode1(true, 0x89, src->reg, dst);
+    return;
+  }
+  if (is_reg64(dst) && is_rm64(src)) {
+    encode1(true, 0x8b, dst->reg, src);
+    return;
+  }
+  if (is_rm8(dst) && src->kind == OP_REG && src->size == 1) {
+    char op = 0x88;
+    encode(false, &op, 1, src->reg, dst, true);
+    return;
+  }
+  if (is_rm64(dst) && src->kind == OP_IMM && is_imm32(src->imm)) {
+    encode1(true, 0xc7, 0, dst);
+    out32(src->imm);
+    return;
+  }
+  if (is_reg64(dst) && src->kind == OP_IMM) {
+    out8(0x48 | (dst->reg >> 3));
+    out8(0xb8 + (dst->reg & 7));
+    out64(src->imm);
+    return;
+  }
+  if (is_rm64(dst) && src->kind == OP_OFFSET) {
+    encode1(true, 0xc7, 0, dst);
+    add_fixup(FIX_ABS32, src->sym);
+    out32(0);
+    return;
+  }
+  asm_error("invalid operands");
+}
+
+static void encode_ins(char *mn, int mnlen, Operand *ops, int nops) {
+  Operand *a = &ops[0];
+  Operand *b = &ops[1];
+  Operand *c = &ops[2];
+
+  if (nops == 0) {
+    if (equal(mn, mnlen, "ret")) {
+      out8(0xc3);
+      return;
+    }
+    if (equal(mn, mnlen, "cqo")) {
+      out8(0x48);
+      out8(0x99);
+      return;
+    }
+    if (equal(mn, mnlen, "vzeroupper")) {
+      out8(0xc5);
+      out8(0xf8);
+      out8(0x77);
+      return;
+    }
+  }
+
+  if (nops == 1) {
+    if (equal(mn, mnlen, "push")) {
+      if (is_reg64(a)) {
+        if (a->reg & 8) out8(0x41);
+        out8(0x50 + (a->reg & 7));
+        return;
+      }
+      if (a->kind == OP_IMM && is_imm8(a->imm)) {
+        out8(0x6a);
+        out8(a->imm);
+        return;
+      }
+      if (a->kind == OP_IMM && is_imm32(a->imm)) {
+        out8(0x68);
+        out32(a->imm);
+        return;
+      }
+      if (a->kind == OP_OFFSET) {
+        out8(0x68);
+        add_fixup(FIX_ABS32, a->sym);
+        out32(0);
+        return;
+      }
+    }
+    if (equal(mn, mnlen, "pop") && is_reg64(a)) {
+      if (a->reg & 8) out8(0x41);
+      out8(0x58 + (a->reg & 7));
+      return;
+    }
+    if (equal(mn, mnlen, "neg") && is_rm64(a)) {
+      encode1(true, 0xf7, 3, a);
+      return;
+    }
+    if (equal(mn, mnlen, "idiv") && is_rm64(a)) {
+      encode1(true, 0xf7, 7, a);
+      return;
+    }
+    if (equal(mn, mnlen, "call") && a->kind == OP_SYM) {
+      out8(0xe8);
+      add_fixup(FIX_CALL, a->sym);
+      out32(0);
+      return;
+    }
+    if (equal(mn, mnlen, "jmp") && a->kind == OP_SYM) {
+      encode_jump(-1, a->sym);
+      return;
+    }
+    if (mnlen > 1 && mn[0] == 'j' && a->kind == OP_SYM) {
+      int cc = cond_code(mn + 1, mnlen - 1);
+      if (cc >= 0) {
+        encode_jump(cc, a->sym);
+        return;
+      }
+    }
+    if (mnlen > 3 && !strncmp(mn, "set", 3) && is_rm8(a)) {
+      int cc = cond_code(mn + 3, mnlen - 3);
+      if (cc >= 0) {
+        char op[] = {0x0f, 0x90 + cc};
+        encode(false, op, 2, 0, a, true);
+        return;
+      }
+    }
+  }
+
+  if (nops == 2) {
+    int alu = alu_code(mn, mnlen);
+    if (alu >= 0) {
+      encode_alu(alu, a, b);
+      return;
+    }
+    if (equal(mn, mnlen, "mov")) {
+      encode_mov(a, b);
+      return;
+    }
+    if (equal(mn, mnlen, "lea") && is_reg64(a) && b->kind == OP_MEM) {
+      encode1(true, 0x8d, a->reg, b);
+      return;
+    }
+    if (equal(mn, mnlen, "imul") && is_reg64(a)) {
+      if (is_rm64(b)) {
+        encode2(true, 0xaf, a->reg, b);
+        return;
+      }
+      if (b->kind == OP_IMM && is_imm8(b->imm)) {
+        encode1(true, 0x6b, a->reg, a);
+        out8(b->imm);
+        return;
+      }
+      if (b->kind == OP_IMM && is_imm32(b->imm)) {
+        encode1(true, 0x69, a->reg, a);
+        out32(b->imm);
+        return;
+      }
+    }
+    if (equal(mn, mnlen, "shl") && is_rm64(a) && b->kind == OP_IMM) {
+      encode1(true, 0xc1, 4, a);
+      out8(b->imm);
+      return;
+    }
+    if ((equal(mn, mnlen, "movzb") || equal(mn, mnlen, "movzx")) &&
+        is_reg64(a) && is_rm8(b)) {
+      char op[] = {0x0f, 0xb6};
+      encode(true, op, 2, a->reg, b, true);
+      return;
+    }
+    if (equal(mn, mnlen, "movsx") && is_reg64(a) && is_rm8(b)) {
+      char op[] = {0x0f, 0xbe};
+      encode(true, op, 2, a->reg, b, true);
+      return;
+    }
+
+    int sse = sse_opcode(mn, mnlen);
+    if (sse >= 0 && is_xmm(a) && (is_xmm(b) || b->kind == OP_MEM)) {
+      encode_sse(0x66, false, sse, a->reg, b);
+      return;
+    }
+    if (equal(mn, mnlen, "movdqu")) {
+      if (is_xmm(a) && b->kind == OP_MEM) {
+        encode_sse(0xf3, false, 0x6f, a->reg, b);
+        return;
+      }
+      if (a->kind == OP_MEM && is_xmm(b)) {
+        encode_sse(0xf3, false, 0x7f, b->reg, a);
+        return;
+      }
+    }
+    if (equal(mn, mnlen, "vmovdqu")) {
+      if (is_vec(a) && b->kind == OP_MEM) {
+        encode_vex(2, 1, is_ymm(a), 0, 0x6f, a->reg, b);
+        return;
+      }
+      if (a->kind == OP_MEM && is_vec(b)) {
+        encode_vex(2, 1, is_ymm(b), 0, 0x7f, b->reg, a);
+        return;
+      }
+    }
+    if (equal(mn, mnlen, "movq") && is_reg64(a) && is_xmm(b)) {
+      encode_sse(0x66, true, 0x7e, b->reg, a);
+      return;
+    }
+  }
+
+  if (nops == 3) {
+    int sse = mnlen > 1 && mn[0] == 'v' ? sse_opcode(mn + 1, mnlen - 1) : -1;
+    if (sse >= 0 && is_vec(a) && is_vec(b) && a->size == b->size &&
+        ((is_vec(c) && c->size == a->size) || c->kind == OP_MEM)) {
+      encode_vex(1, 1, is_ymm(a), b->reg, sse, a->reg, c);
+      return;
+    }
+    if (equal(mn, mnlen, "pshufd") && is_xmm(a) &&
+        (is_xmm(b) || b->kind == OP_MEM) && c->kind == OP_IMM) {
+      encode_sse(0x66, false, 0x70, a->reg, b);
+      out8(c->imm);
+      return;
+    }
+    if (equal(mn, mnlen, "vextracti128") && (is_xmm(a) || a->kind == OP_MEM) &&
+        is_ymm(b) && c->kind == OP_IMM) {
+      encode_vex(1, 3, true, 0, 0x39, b->reg, a);
+      out8(c->imm);
+      return;
+    }
+  }
+
+  asm_error("unsupported instruction");
+}
+
+//
+// 疑似命令
+//
+
+static void define_label(char *s, int len) {
+  AsmSym *sym = get_sym(s, len);
+  if (sym->section != SEC_UNDEF) asm_error("symbol already defined");
+  sym->section = cur_section;
+  sym->value = section_buf()->len;
+}
+
+// .stringの引数を解釈して、NUL終端付きで書き込む
+static void write_string(Buf *buf, char *p, char *end) {
+  if (p >= end || *p != '"' || end[-1] != '"' || end - p < 2)
+    asm_error("invalid string");
+  p++;
+  end--;
+
+  while (p < end) {
+    char c = *p++;
+    if (c == '\\' && p < end) {
+      c = *p++;
+      if ('0' <= c && c <= '7') {
+        int v = c - '0';
+        for (int i = 0; i < 2 && p < end && '0' <= *p && *p <= '7'; i++)
+          v = v * 8 + *p++ - '0';
+        c = v;
+      } else if (c == 'n') {
+        c = '\n';
+      } else if (c == 't') {
+        c = '\t';
+      }
+    }
+    buf_write(buf, &c, 1);
+  }
+  buf_write(buf, "", 1);
+}
+
+static void directive(char *p, char *end) {
+  char *q = p;
+  while (q < end && *q != ' ' && *q != '\t') q++;
+  int len = q - p;
+  char *arg = skip_space(q, end);
+
+  if (equal(p, len, ".intel_syntax")) return;
+  if (equal(p, len, ".text")) {
+    cur_section = SEC_TEXT;
+    return;
+  }
+  if (equal(p, len, ".data")) {
+    cur_section = SEC_DATA;
+    return;
+  }
+  if (equal(p, len, ".global") || equal(p, len, ".globl")) {
+    get_sym(arg, end - arg)->global = true;
+    return;
+  }
+  if (equal(p, len, ".zero")) {
+    Buf *buf = section_buf();
+    for (long n = parse_num(arg, end - arg); n > 0; n--) buf_write(buf, "", 1);
+    return;
+  }
+  if (equal(p, len, ".string")) {
+    write_string(section_buf(), arg, end);
+    return;
+  }
+  asm_error("unsupported directive");
+}
+
+static void assemble_line(char *p, char *end) {
+  line_start = p;
+  line_len = end - p;
+
+  p = skip_space(p, end);
+  while (end > p && (end[-1] == ' ' || end[-1] == '\t')) end--;
+  if (p == end) return;
+
+  // ラベル
+  if (end[-1] == ':') {
+    define_label(p, end - p - 1);
+    return;
+  }
+
+  if (*p == '.') {
+    directive(p, end);
+    return;
+  }
+
+  if (cur_section != SEC_TEXT) asm_error("instruction outside of .text");
+
+  char *q = p;
+  while (q < end && *q != ' ' && *q != '\t') q++;
+  char *mn = p;
+  int mnlen = q - p;
+
+  Operand ops[3];
+  int nops = 0;
+  p = skip_space(q, end);
+  while (p < end) {
+    if (nops == 3) asm_error("too many operands");
+    q = memchr(p, ',', end - p);
+    if (!q) q = end;
+
+    char *e = q;
+    while (e > p && (e[-1] == ' ' || e[-1] == '\t')) e--;
+    parse_operand(&ops[nops++], p, e);
+    p = q < end ? skip_space(q + 1, end) : end;
+  }
+
+  encode_ins(mn, mnlen, ops, nops);
+}
+
+//
+// ELFファイルの出力
+//
+
+enum {
+  SH_NULL,
+  SH_TEXT,
+  SH_DATA,
+  SH_RELA_TEXT,
+  SH_SYMTAB,
+  SH_STRTAB,
+  SH_SHSTRTAB,
+  SH_NOTE_STACK,
+  NUM_SECTIONS,
+};
+
+static int sec_to_shndx(int section) {
+  return section == SEC_TEXT ? SH_TEXT : section == SEC_DATA ? SH_DATA : 0;
+}
+
+static void pad_to(Buf *buf, int align) {
+  while (buf->len % align) buf_write(buf, "", 1);
+}
+
+static int add_string(Buf *strtab, char *s, int len) {
+  int off = strtab->len;
+  buf_write(strtab, s, len);
+  buf_write(strtab, "", 1);
+  return off;
+}
+
+static void write_elf(Buf *out) {
+  // ローカルシンボルを先に、グローバルシンボルを後に並べる。
+  // .L.で始まるラベルはシンボルテーブルに載せない
+  Buf strtab = {};
+  Buf symtab = {};
+  buf_write(&strtab, "", 1);
+
+  Elf64_Sym null_sym = {};
+  buf_write(&symtab, (char *)&null_sym, sizeof(null_sym));
+  for (int shndx = SH_TEXT; shndx <= SH_DATA; shndx++) {
+    Elf64_Sym sym = {};
+    sym.st_info = ELF64_ST_INFO(STB_LOCAL, STT_SECTION);
+    sym.st_shndx = shndx;
+    buf_write(&symtab, (char *)&sym, sizeof(sym));
+  }
+
+  int nsym = 3;
+  int first_global = 0;
+  for (int pass = 0; pass < 2; pass++) {
+    if (pass == 1) first_global = nsym;
+
+    for (int i = 0; i < nsyms; i++) {
+      AsmSym *s = sym_list[i];
+      bool global = s->global || s->section == SEC_UNDEF;
+      if (global != (pass == 1)) continue;
+      if (is_local_label(s)) {
+        if (s->section == SEC_UNDEF)
+          error("assembler: undefined label: %s", s->name->name);
+        continue;
+      }
+
+      Elf64_Sym sym = {};
+      sym.st_name = add_string(&strtab, s->name->name, s->name->len);
+      int type = s->section == SEC_TEXT   ? STT_FUNC
+                 : s->section == SEC_DATA ? STT_OBJECT
+                                          : STT_NOTYPE;
+      sym.st_info = ELF64_ST_INFO(global ? STB_GLOBAL : STB_LOCAL, type);
+      sym.st_shndx = sec_to_shndx(s->section);
+      sym.st_value = s->value;
+      buf_write(&symtab, (char *)&sym, sizeof(sym));
+      s->index = nsym++;
+    }
+  }
+
+  // 再配置
+  Buf rela = {};
+  for (int i = 0; i < nfixups; i++) {
+    Fixup *fx = &fixups[i];
+    AsmSym *s = fx->sym;
+
+    // 同じセクション内のローカルなラベルへのジャンプと呼び出しはここで解決する
+    if (fx->kind != FIX_ABS32 && s->section == SEC_TEXT && !s->global) {
+      int rel = s->value - (fx->offset + 4);
+      memcpy(text.data + fx->offset, &rel, 4);
+      continue;
+    }
+
+    Elf64_Rela r = {};
+    r.r_offset = fx->offset;
+    if (fx->kind == FIX_ABS32) {
+      // 定義済みのシンボルはセクションシンボルからの相対で参照する
+      if (s->section != SEC_UNDEF) {
+        r.r_info = ELF64_R_INFO(sec_to_shndx(s->section), R_X86_64_32S);
+        r.r_addend = s->value;
+      } else {
+        r.r_info = ELF64_R_INFO(s->index, R_X86_64_32S);
+      }
+    } else {
+      if (is_local_label(s)) error("assembler: undefined label: %s", s->name->name);
+      r.r_info = ELF64_R_INFO(s->index, R_X86_64_PLT32);
+      r.r_addend = -4;
+    }
+    buf_write(&rela, (char *)&r, sizeof(r));
+  }
+
+  Buf shstrtab = {};
+  buf_write(&shstrtab, "", 1);
+  char *names[] = {NULL,       ".text",   ".data",     ".rela.text",
+                   ".symtab", ".strtab", ".shstrtab", ".note.GNU-stack"};
+  int name_off[NUM_SECTIONS] = {};
+  for (int i = 1; i < NUM_SECTIONS; i++)
+    name_off[i] = add_string(&shstrtab, names[i], strlen(names[i]));
+
+  Elf64_Shdr sh[NUM_SECTIONS] = {};
+  Buf *contents[NUM_SECTIONS] = {
+      NULL, &text, &data, &rela, &symtab, &strtab, &shstrtab, NULL,
+  };
+
+  out->len = 0;
+  Elf64_Ehdr eh = {};
+  buf_write(out, (char *)&eh, sizeof(eh));
+
+  for (int i = 1; i < NUM_SECTIONS; i++) {
+    pad_to(out, 8);
+    sh[i].sh_name = name_off[i];
+    sh[i].sh_offset = out->len;
+    if (contents[i]) {
+      sh[i].sh_size = contents[i]->len;
+      buf_write(out, contents[i]->data, contents[i]->len);
+    }
+  }
+
+  sh[SH_TEXT].sh_type = SHT_PROGBITS;
+  sh[SH_TEXT].sh_flags = SHF_ALLOC | SHF_EXECINSTR;
+  sh[SH_TEXT].sh_addralign = 16;
+
+  sh[SH_DATA].sh_type = SHT_PROGBITS;
+  sh[SH_DATA].sh_flags = SHF_ALLOC | SHF_WRITE;
+  sh[SH_DATA].sh_addralign = 8;
+
+  sh[SH_RELA_TEXT].sh_type = SHT_RELA;
+  sh[SH_RELA_TEXT].sh_flags = SHF_INFO_LINK;
+  sh[SH_RELA_TEXT].sh_link = SH_SYMTAB;
+  sh[SH_RELA_TEXT].sh_info = SH_TEXT;
+  sh[SH_RELA_TEXT].sh_addralign = 8;
+  sh[SH_RELA_TEXT].sh_entsize = sizeof(Elf64_Rela);
+
+  sh[SH_SYMTAB].sh_type = SHT_SYMTAB;
+  sh[SH_SYMTAB].sh_link = SH_STRTAB;
+  sh[SH_SYMTAB].sh_info = first_global;
+  sh[SH_SYMTAB].sh_addralign = 8;
+  sh[SH_SYMTAB].sh_entsize = sizeof(Elf64_Sym);
+
+  sh[SH_STRTAB].sh_type = SHT_STRTAB;
+  sh[SH_STRTAB].sh_addralign = 1;
+  sh[SH_SHSTRTAB].sh_type = SHT_STRTAB;
+  sh[SH_SHSTRTAB].sh_addralign = 1;
+
+  // 実行可能なスタックを要求しないことをリンカに伝える
+  sh[SH_NOTE_STACK].sh_type = SHT_PROGBITS;
+  sh[SH_NOTE_STACK].sh_addralign = 1;
+
+  pad_to(out, 8);
+  long shoff = out->len;
+  buf_write(out, (char *)sh, sizeof(sh));
+
+  memcpy(eh.e_ident, ELFMAG, SELFMAG);
+  eh.e_ident[EI_CLASS] = ELFCLASS64;
+  eh.e_ident[EI_DATA] = ELFDATA2LSB;
+  eh.e_ident[EI_VERSION] = EV_CURRENT;
+  eh.e_ident[EI_OSABI] = ELFOSABI_SYSV;
+  eh.e_type = ET_REL;
+  eh.e_machine = EM_X86_64;
+  eh.e_version = EV_CURRENT;
+  eh.e_shoff = shoff;
+  eh.e_ehsize = sizeof(Elf64_Ehdr);
+  eh.e_shentsize = sizeof(Elf64_Shdr);
+  eh.e_shnum = NUM_SECTIONS;
+  eh.e_shstrndx = SH_SHSTRTAB;
+  memcpy(out->data, &eh, sizeof(eh));
+
+  free(strtab.data);
+  free(symtab.data);
+  free(rela.data);
+  free(shstrtab.data);
+}
+
+// 次の翻訳単位を同じスレッドで変換できるよう、状態を空に戻す
+static void reset(void) {
+  for (int i = 0; i < nsyms; i++) {
+    syms[sym_list[i]->name->id] = NULL;
+    free(sym_list[i]);
+  }
+  free(sym_list);
+  sym_list = NULL;
+  nsyms = 0;
+  nfixups = 0;
+
+  free(text.data);
+  free(data.data);
+  text = (Buf){};
+  data = (Buf){};
+  cur_section = SEC_UNDEF;
+}
+
+// アセンブリsrcを変換したオブジェクトファイルの内容をoutに書き込む
+void assemble(char *src, size_t len, Buf *out) {
+  // --serverでは前の要求がエラーで途中で打ち切られているかもしれない
+  reset();
+
+  char *p = src;
+  char *end = src + len;
+  while (p < end) {
+    char *q = memchr(p, '\n', end - p);
+    if (!q) q = end;
+    assemble_line(p, q);
+    p = q + 1;
+  }
+
+  write_elf(out);
+  reset();
+}
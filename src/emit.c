@@ -0,0 +1,148 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// アセンブリの出力。命令ごとにprintfを呼ぶ代わりに大きなバッファへ書き込み、
+// 溜まったらwrite(2)でまとめて書き出す。
+// 書式は%s, %d, %ld, %%だけを自前で解釈する。
+// オブジェクトファイルを出力する場合(-c)は、最後にまとめてelf.cで変換する。
+// 出力先とバッファは翻訳単位(tu)ごとに持つ。出力先がなければ(--server)、
+// 出力はすべてバッファに残る。
+//
+
+#define FLUSH_SIZE (1024 * 1024)
+
+_Thread_local Buf *emit_buf;
+
+void buf_write(Buf *buf, char *s, size_t len) {
+  if (buf->len + len > buf->cap) {
+    size_t cap = buf->cap ? buf->cap : 4096;
+    while (cap < buf->len + len) cap *= 2;
+    buf->data = realloc(buf->data, cap);
+    buf->cap = cap;
+  }
+  memcpy(buf->data + buf->len, s, len);
+  buf->len += len;
+}
+
+// 10進数の文字列にして書き込む
+static void write_long(Buf *buf, long val) {
+  char tmp[24];
+  char *p = tmp + sizeof(tmp);
+  unsigned long u = val < 0 ? -(unsigned long)val : val;
+
+  do {
+    *--p = '0' + u % 10;
+    u /= 10;
+  } while (u);
+  if (val < 0) *--p = '-';
+
+  buf_write(buf, p, tmp + sizeof(tmp) - p);
+}
+
+void emit(char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+
+  char *p = fmt;
+  for (;;) {
+    // 次の'%'までは文字列をそのまま書き込む
+    char *q = p;
+    while (*q && *q != '%') q++;
+    if (q != p) buf_write(emit_buf, p, q - p);
+    if (!*q) break;
+
+    switch (q[1]) {
+      case 's': {
+        char *s = va_arg(ap, char *);
+        buf_write(emit_buf, s, strlen(s));
+        p = q + 2;
+        continue;
+      }
+      case 'd':
+        write_long(emit_buf, va_arg(ap, int));
+        p = q + 2;
+        continue;
+      case 'l':
+        if (q[2] != 'd') break;
+        write_long(emit_buf, va_arg(ap, long));
+        p = q + 3;
+        continue;
+      case '%':
+        buf_write(emit_buf, "%", 1);
+        p = q + 2;
+        continue;
+    }
+    error("emit: unsupported format: %s", fmt);
+  }
+
+  va_end(ap);
+}
+
+// 翻訳単位の出力先(tu->out_path)を開く。"-"は標準出力。
+// tu->objectならアセンブリの代わりにオブジェクトファイルを書き出す
+void open_output(void) {
+  emit_buf = &tu->out;
+  if (!tu->out_path) {
+    tu->out_fd = -1;
+    return;
+  }
+
+  if (!strcmp(tu->out_path, "-")) {
+    tu->out_fd = 1;
+    return;
+  }
+
+  tu->out_fd = open(tu->out_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (tu->out_fd < 0)
+    error("cannot open output file %s: %s", tu->out_path, strerror(errno));
+}
+
+// 出力先を閉じる。残りはflush_output(true)で書き出しておく
+void close_output(void) {
+  if (tu->out_fd > 1) close(tu->out_fd);
+  emit_buf = NULL;
+}
+
+void write_all(int fd, char *data, size_t len) {
+  while (len > 0) {
+    ssize_t n = write(fd, data, len);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      error("%s: write failed: %s", tu->out_path, strerror(errno));
+    }
+    data += n;
+    len -= n;
+  }
+}
+
+// バッファが十分に溜まっていれば書き出す。forceなら残りをすべて書き出す
+void flush_output(bool force) {
+  Buf *out = &tu->out;
+  if (tu->object) {
+    // ラベルを解決するために、アセンブリ全体が揃ってから変換する
+    if (!force) return;
+    Buf obj = {};
+    assemble(out->data, out->len, &obj);
+    if (tu->out_fd < 0) {
+      free(out->data);
+      *out = obj;
+      return;
+    }
+    write_all(tu->out_fd, obj.data, obj.len);
+    free(obj.data);
+    out->len = 0;
+    return;
+  }
+
+  if (tu->out_fd < 0 || (!force && out->len < FLUSH_SIZE)) return;
+  write_all(tu->out_fd, out->data, out->len);
+  out->len = 0;
+}
+
+// 別のバッファに生成したアセンブリを出力に加える
+void output_buf(Buf *buf) {
+  if (collect_stats) count_insns(buf->data, buf->len);
+  buf_write(&tu->out, buf->data, buf->len);
+  flush_output(false);
+}
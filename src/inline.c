@@ -0,0 +1,229 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// 小さな葉関数(他の関数を呼ばない関数)のインライン展開。
+// 呼び出し f(a, b) を、仮引数に当たる新しいローカル変数を呼び出し元に作った
+// ステートメント式 ({ x = a; y = b; ...本体...; 戻り値の式; }) に書き換える。
+// 本体の途中から抜けるreturnは表せないので、returnは本体の最上位の最後の
+// 文にあるものだけを扱う(それより後ろの文は実行されないので捨てる)。
+//
+
+// 展開する関数の大きさ(ノード数)の上限。0ならインライン展開しない
+int opt_inline_limit;
+
+// 呼び出し先の情報。関数名のSymbolの番号で引く
+typedef struct {
+  Function *fn;
+  InlineDecision decision;
+  int nparams;
+  Node *ret;  // 本体の最上位にある最初のreturn
+} Callee;
+
+static _Thread_local Callee *callees;  // fnがNULLなら定義のない関数
+
+// ノード数を数える。上限を超えたらそれ以上は数えない
+static int count_nodes(Node *node, int limit) {
+  int n = 0;
+  for (; node && n <= limit; node = node->next) {
+    n++;
+    Node **slots[MAX_NODE_SLOTS];
+    int nslots = node_slots(node, slots);
+    for (int i = 0; i < nslots; i++) n += count_nodes(*slots[i], limit - n);
+  }
+  return n;
+}
+
+// 部分木に関数呼び出しかreturnがあるか
+static bool has_kind(Node *node, NodeKind kind) {
+  for (; node; node = node->next) {
+    if (node->kind == kind) return true;
+    Node **slots[MAX_NODE_SLOTS];
+    int nslots = node_slots(node, slots);
+    for (int i = 0; i < nslots; i++)
+      if (has_kind(*slots[i], kind)) return true;
+  }
+  return false;
+}
+
+static InlineDecision judge(Callee *c) {
+  Function *fn = c->fn;
+  Node *ret = fn->node;
+  while (ret && ret->kind != ND_RETURN) ret = ret->next;
+  if (!ret) return INL_NO_RETURN;
+  c->ret = ret;
+
+  // returnより後ろの文は数えない
+  Node *rest = ret->next;
+  ret->next = NULL;
+  InlineDecision d = INL_DONE;
+  if (has_kind(fn->node, ND_FUNCALL))
+    d = INL_NOT_LEAF;
+  else if (count_nodes(fn->node, opt_inline_limit) > opt_inline_limit)
+    d = INL_TOO_LARGE;
+  else if (ret != fn->node) {
+    // retより前の文だけを調べる。つないだままだとret自身が見つかってしまう
+    Node *prev = fn->node;
+    while (prev->next != ret) prev = prev->next;
+    prev->next = NULL;
+    if (has_kind(fn->node, ND_RETURN)) d = INL_EARLY_RETURN;
+    prev->next = ret;
+  }
+  ret->next = rest;
+
+  for (VarList *vl = fn->params; vl; vl = vl->next) c->nparams++;
+  return d;
+}
+
+// 複製中の関数の変数と、呼び出し元に作った変数の対応
+typedef struct {
+  Var **from;
+  Var **to;
+  int len;
+  Function *fn;    // 呼び出し元
+  BlockScope *bs;  // 呼び出しを囲む最も内側のブロック
+} VarMap;
+
+static void add_var(VarList **list, Var *var) {
+  VarList *vl = arena_alloc(&tu->ast_arena, sizeof(VarList));
+  vl->var = var;
+  vl->next = *list;
+  *list = vl;
+}
+
+static Var *map_var(VarMap *map, Var *var) {
+  if (!var->is_local) return var;
+  for (int i = 0; i < map->len; i++)
+    if (map->from[i] == var) return map->to[i];
+
+  // 展開した本体のブロックはまとめて呼び出し側のブロックに属させる
+  Var *copy = arena_alloc(&tu->ast_arena, sizeof(Var));
+  *copy = *var;
+  add_var(&map->fn->locals, copy);
+  add_var(&map->bs->vars, copy);
+
+  map->from = realloc(map->from, sizeof(Var *) * (map->len + 1));
+  map->to = realloc(map->to, sizeof(Var *) * (map->len + 1));
+  map->from[map->len] = var;
+  map->to[map->len++] = copy;
+  return copy;
+}
+
+static Node *copy_node(VarMap *map, Node *node);
+
+// `next`でつながったリストを複製する。endに来たら止める
+static Node *copy_list(VarMap *map, Node *node, Node *end) {
+  Node head = {};
+  Node *cur = &head;
+  for (; node != end; node = node->next)
+    cur = cur->next = copy_node(map, node);
+  return head.next;
+}
+
+static Node *copy_node(VarMap *map, Node *node) {
+  if (!node) return NULL;
+
+  Node *copy = arena_alloc(&tu->ast_arena, node_size(node->kind));
+  memcpy(copy, node, node_size(node->kind));
+  copy->next = NULL;
+
+  // 1つのノードの子はnextがNULLなので、リストとして複製してよい
+  Node **slots[MAX_NODE_SLOTS];
+  int nslots = node_slots(copy, slots);
+  for (int i = 0; i < nslots; i++) *slots[i] = copy_list(map, *slots[i], NULL);
+
+  if (node->kind == ND_BLOCK || node->kind == ND_STMT_EXPR) copy->scope = NULL;
+  if (node->kind == ND_VAR) copy->var = map_var(map, node->var);
+  return copy;
+}
+
+// 呼び出しノードをステートメント式に書き換える
+static void expand(Node *node, Callee *c, Function *fn, BlockScope *bs) {
+  VarMap map = {.fn = fn, .bs = bs};
+  Node head = {};
+  Node *cur = &head;
+
+  // 仮引数への代入。実引数は左から順に評価する
+  Node *arg = node->args;
+  for (VarList *vl = c->fn->params; vl; vl = vl->next) {
+    Node *next = arg->next;
+    arg->next = NULL;
+
+    Node *var = arena_alloc(&tu->ast_arena, node_size(ND_VAR));
+    var->kind = ND_VAR;
+    var->tok = arg->tok;
+    var->var = map_var(&map, vl->var);
+    add_type(var);
+
+    Node *assign = arena_alloc(&tu->ast_arena, node_size(ND_ASSIGN));
+    assign->kind = ND_ASSIGN;
+    assign->tok = arg->tok;
+    assign->lhs = var;
+    assign->rhs = arg;
+    add_type(assign);
+
+    Node *stmt = arena_alloc(&tu->ast_arena, node_size(ND_EXPR_STMT));
+    stmt->kind = ND_EXPR_STMT;
+    stmt->tok = arg->tok;
+    stmt->lhs = assign;
+    cur = cur->next = stmt;
+    arg = next;
+  }
+
+  cur->next = copy_list(&map, c->fn->node, c->ret);
+  while (cur->next) cur = cur->next;
+  cur->next = copy_node(&map, c->ret->lhs);
+
+  // 型は呼び出しと同じintのままにする。ND_FUNCALLとND_STMT_EXPRは同じ大きさ
+  node->kind = ND_STMT_EXPR;
+  node->body = head.next;
+  node->scope = NULL;
+
+  free(map.from);
+  free(map.to);
+}
+
+static void walk_list(Node *node, Function *fn, BlockScope *bs);
+
+static void walk(Node *node, Function *fn, BlockScope *bs) {
+  if ((node->kind == ND_BLOCK || node->kind == ND_STMT_EXPR) && node->scope)
+    bs = node->scope;
+
+  Node **slots[MAX_NODE_SLOTS];
+  int nslots = node_slots(node, slots);
+  for (int i = 0; i < nslots; i++) walk_list(*slots[i], fn, bs);
+
+  if (node->kind != ND_FUNCALL) return;
+
+  Callee *c = &callees[intern(node->funcname, strlen(node->funcname))->id];
+  InlineDecision d = c->fn ? c->decision : INL_UNDEFINED;
+  if (d == INL_DONE) {
+    int nargs = 0;
+    for (Node *arg = node->args; arg; arg = arg->next) nargs++;
+    if (nargs != c->nparams) d = INL_ARGS;
+  }
+
+  tu->stats.inline_sites[d]++;
+  if (d == INL_DONE) expand(node, c, fn, bs);
+}
+
+static void walk_list(Node *node, Function *fn, BlockScope *bs) {
+  for (Node *n = node; n; n = n->next) walk(n, fn, bs);
+}
+
+void inline_functions(Program *prog) {
+  // 呼び出しの関数名もSymbolを経由しているので、番号の範囲に収まる
+  int nsyms = nsymbols();
+  callees = calloc(nsyms, sizeof(Callee));
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    callees[intern(fn->name, strlen(fn->name))->id].fn = fn;
+
+  for (int i = 0; i < nsyms; i++)
+    if (callees[i].fn) callees[i].decision = judge(&callees[i]);
+
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    walk_list(fn->node, fn, fn->scope);
+
+  free(callees);
+  callees = NULL;
+}
@@ -0,0 +1,100 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// ソースファイルを読み込む。
+// 通常のファイルはmmapでそのままメモリに割り当て、トークナイザは
+// コピーせずにその上を走査する。パイプや標準入力(`-`)は伸長するバッファに読み込む。
+// どちらの場合も、返す内容は必ず"\n\0"で終わる。
+//
+
+// 末尾に改行とNUL終端がなければ付け足す。bufにはsize+2バイト以上の領域が必要
+static char *terminate(char *buf, size_t size) {
+  if (size == 0 || buf[size - 1] != '\n') buf[size++] = '\n';
+  buf[size] = '\0';
+  return buf;
+}
+
+// 大きさsizeのファイルをmmapする領域の大きさ
+static size_t map_len(size_t size) {
+  size_t pagesz = sysconf(_SC_PAGESIZE);
+  return (size + pagesz - 1) / pagesz * pagesz + pagesz;
+}
+
+// ファイルをmmapする。失敗した場合はNULLを返す
+static char *map_file(int fd, size_t size) {
+  size_t len = map_len(size);
+
+  // 先に1ページ余分に匿名領域を確保し、その先頭にファイルを重ねる。
+  // ファイル末尾の直後は、最後のページの余りか、このガードページになるので
+  // 必ずゼロで埋まっていて書き込みもできる。MAP_PRIVATEなのでファイルは変わらない
+  char *buf = mmap(NULL, len, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (buf == MAP_FAILED) return NULL;
+
+  if (size && mmap(buf, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED,
+                   fd, 0) == MAP_FAILED) {
+    munmap(buf, len);
+    return NULL;
+  }
+  return terminate(buf, size);
+}
+
+// 終端まで読み込む。サイズが分からない入力に使う
+static char *read_stream(int fd, char *path) {
+  size_t cap = 64 * 1024;
+  size_t size = 0;
+  char *buf = malloc(cap);
+
+  for (;;) {
+    // 末尾の"\n\0"の2バイトを除いて空きがなければ伸ばす。
+    // 0バイトのreadは終端と区別できない
+    if (cap - size <= 2) {
+      cap *= 2;
+      buf = realloc(buf, cap);
+    }
+
+    ssize_t n = read(fd, buf + size, cap - size - 2);
+    if (n == 0) break;
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      error("%s: read failed: %s", path, strerror(errno));
+    }
+    size += n;
+  }
+  return terminate(buf, size);
+}
+
+// 指定されたファイルの内容を返す。どう確保したかはtuに覚えておき、free_inputで解放する
+char *read_file(char *path) {
+  int fd = 0;
+  if (strcmp(path, "-")) {
+    fd = open(path, O_RDONLY);
+    if (fd < 0) error("cannot open %s: %s", path, strerror(errno));
+  }
+
+  struct stat st;
+  char *buf = NULL;
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+    buf = map_file(fd, st.st_size);
+  if (buf) {
+    tu->input_map_len = map_len(st.st_size);
+  } else {
+    buf = read_stream(fd, path);
+    tu->input_malloced = true;
+  }
+
+  if (fd != 0) close(fd);
+  return buf;
+}
+
+// read_fileで読んだ入力を解放する。それ以外の方法で渡された入力はそのまま残す
+void free_input(TU *t) {
+  if (t->input_map_len)
+    munmap(t->user_input, t->input_map_len);
+  else if (t->input_malloced)
+    free(t->user_input);
+  t->user_input = NULL;
+  t->input_map_len = 0;
+  t->input_malloced = false;
+}
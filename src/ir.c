@@ -0,0 +1,867 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// 抽象構文木を仮想レジスタを使う線形な中間表現(IR)に変換し、
+// レジスタ割り当て(regalloc.c)の結果を使ってアセンブリを出力する。
+// スタックマシン(codegen.c)と違い、中間値をpush/popで受け渡さない。
+//
+
+static char *argreg1[] = {"dil", "sil", "dl", "cl", "r8b", "r9b"};
+static char *argreg8[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
+
+static _Thread_local IRFunc *irf;  // このスレッドで変換中の関数
+
+// ループの間だけ仮想レジスタに置く値。
+// addrなら配列のアドレス(ループ不変)、そうでなければ帰納変数の値
+typedef struct {
+  Var *var;
+  bool addr;
+  int vreg;
+} Promoted;
+
+#define MAX_PROMOTED 4        // 入れ子のループ全体で置ける個数
+#define MAX_HOISTED_ARRAYS 2  // 1つのループで移動する配列のアドレスの個数
+
+static _Thread_local Promoted promoted[MAX_PROMOTED];
+static _Thread_local int npromoted;
+
+static int lower_expr(Node *node);
+static void lower_stmt(Node *node);
+
+static IR *new_ir(IROp op) {
+  if (irf->len == irf->cap) {
+    irf->cap = irf->cap ? irf->cap * 2 : 64;
+    irf->ins = realloc(irf->ins, sizeof(IR) * irf->cap);
+  }
+  IR *ir = &irf->ins[irf->len++];
+  memset(ir, 0, sizeof(IR));
+  ir->op = op;
+  return ir;
+}
+
+static int new_vreg(void) { return ++irf->nvreg; }
+
+static int emit_imm(long imm) {
+  IR *ir = new_ir(IR_IMM);
+  ir->d = new_vreg();
+  ir->imm = imm;
+  return ir->d;
+}
+
+static int emit_binop(IROp op, int a, int b) {
+  IR *ir = new_ir(op);
+  ir->d = new_vreg();
+  ir->a = a;
+  ir->b = b;
+  return ir->d;
+}
+
+// 右辺が即値の二項演算
+static int emit_binop_imm(IROp op, int a, long imm) {
+  IR *ir = new_ir(op);
+  ir->d = new_vreg();
+  ir->a = a;
+  ir->imm = imm;
+  return ir->d;
+}
+
+static void emit_label(char *lname, int label) {
+  IR *ir = new_ir(IR_LABEL);
+  ir->lname = lname;
+  ir->label = label;
+}
+
+static void emit_jmp(char *lname, int label) {
+  IR *ir = new_ir(IR_JMP);
+  ir->lname = lname;
+  ir->label = label;
+}
+
+static bool is_imm32(Node *node) {
+  return node->kind == ND_NUM && node->val == (int)node->val;
+}
+
+// 両辺を入れ替えたときの条件コード
+static char *swap_cc(char *cc) {
+  static char *pairs[][2] = {
+      {"l", "g"}, {"le", "ge"}, {"g", "l"}, {"ge", "le"}};
+  for (int i = 0; i < 4; i++)
+    if (!strcmp(cc, pairs[i][0])) return pairs[i][1];
+  return cc;
+}
+
+// condの真偽がjump_ifと等しければラベルへジャンプする。
+// 比較演算子なら0/1の値を作らず、比較の結果で直接分岐する
+static void emit_branch(Node *cond, bool jump_if, char *lname, int label) {
+  char *cc = cond_cc(cond->kind, !jump_if);
+  int a, b = 0;
+  long imm = 0;
+
+  if (cc) {
+    // パーサはx > 3を3 < xにするので、定数を右辺に戻して即値にする
+    Node *lhs = cond->lhs;
+    Node *rhs = cond->rhs;
+    if (is_imm32(lhs) && !is_imm32(rhs)) {
+      lhs = cond->rhs;
+      rhs = cond->lhs;
+      cc = swap_cc(cc);
+    }
+
+    a = lower_expr(lhs);
+    if (is_imm32(rhs))
+      imm = rhs->val;
+    else
+      b = lower_expr(rhs);
+  } else {
+    a = lower_expr(cond);
+    cc = jump_if ? "ne" : "e";
+  }
+
+  IR *ir = new_ir(IR_BCMP);
+  ir->a = a;
+  ir->b = b;
+  ir->imm = imm;
+  ir->cc = cc;
+  ir->lname = lname;
+  ir->label = label;
+}
+
+static int emit_load(int addr, Type *ty) {
+  IR *ir = new_ir(IR_LOAD);
+  ir->d = new_vreg();
+  ir->a = addr;
+  ir->size = ty->size;
+  return ir->d;
+}
+
+static void emit_mov(int d, int a) {
+  IR *ir = new_ir(IR_MOV);
+  ir->d = d;
+  ir->a = a;
+}
+
+static Promoted *find_promoted(Var *var, bool addr) {
+  for (int i = npromoted - 1; i >= 0; i--)
+    if (promoted[i].var == var && promoted[i].addr == addr)
+      return &promoted[i];
+  return NULL;
+}
+
+// 変数やメンバのアドレスを計算する
+static int lower_addr(Node *node) {
+  switch (node->kind) {
+    case ND_VAR: {
+      Promoted *p = find_promoted(node->var, true);
+      if (p) return p->vreg;
+
+      IR *ir = new_ir(node->var->is_local ? IR_LVAR : IR_GVAR);
+      ir->d = new_vreg();
+      ir->var = node->var;
+      return ir->d;
+    }
+    case ND_DEREF:
+      return lower_expr(node->lhs);
+    case ND_MEMBER: {
+      int base = lower_addr(node->lhs);
+      return emit_binop_imm(IR_ADD, base, node->member->offset);
+    }
+  }
+
+  error_tok(node->tok, "not an lvalue");
+}
+
+// 関数呼び出し。引数は左から順に評価する
+static IR *lower_call(Node *node, IROp op) {
+  int args[6];
+  int nargs = 0;
+  for (Node *arg = node->args; arg; arg = arg->next) {
+    if (nargs == 6) error_tok(arg->tok, "too many arguments");
+    args[nargs++] = lower_expr(arg);
+  }
+
+  IR *ir = new_ir(op);
+  if (op == IR_CALL) ir->d = new_vreg();
+  ir->funcname = node->funcname;
+  ir->nargs = nargs;
+  memcpy(ir->args, args, sizeof(args));
+  return ir;
+}
+
+static int lower_expr(Node *node) {
+  switch (node->kind) {
+    case ND_NUM:
+      return emit_imm(node->val);
+    case ND_VAR:
+    case ND_MEMBER: {
+      // レジスタに置いた変数は、後で書き換わってもよいようにコピーを返す
+      Promoted *p = node->kind == ND_VAR ? find_promoted(node->var, false) : NULL;
+      if (p) {
+        int d = new_vreg();
+        emit_mov(d, p->vreg);
+        return d;
+      }
+
+      int addr = lower_addr(node);
+      if (node->ty->kind == TY_ARRAY) return addr;
+      return emit_load(addr, node->ty);
+    }
+    case ND_ASSIGN: {
+      if (node->lhs->ty->kind == TY_ARRAY)
+        error_tok(node->lhs->tok, "not an lvalue");
+
+      Promoted *p = node->lhs->kind == ND_VAR
+                        ? find_promoted(node->lhs->var, false)
+                        : NULL;
+      if (p) {
+        int val = lower_expr(node->rhs);
+        emit_mov(p->vreg, val);
+        return val;
+      }
+
+      int addr = lower_addr(node->lhs);
+      int val = lower_expr(node->rhs);
+      IR *ir = new_ir(IR_STORE);
+      ir->a = addr;
+      ir->b = val;
+      ir->size = node->ty->size;
+      return val;
+    }
+    case ND_ADDR:
+      return lower_addr(node->lhs);
+    case ND_DEREF: {
+      int addr = lower_expr(node->lhs);
+      if (node->ty->kind == TY_ARRAY) return addr;
+      return emit_load(addr, node->ty);
+    }
+    case ND_STMT_EXPR: {
+      Node *n = node->body;
+      for (; n->next; n = n->next) lower_stmt(n);
+      return lower_expr(n);
+    }
+    case ND_NEG: {
+      // 先にオペランドを変換してから命令を追加する
+      int a = lower_expr(node->lhs);
+      IR *ir = new_ir(IR_NEG);
+      ir->a = a;
+      ir->d = new_vreg();
+      return ir->d;
+    }
+    case ND_SHL:
+      return emit_binop_imm(IR_SHL, lower_expr(node->lhs), node->rhs->val);
+    case ND_FUNCALL:
+      return lower_call(node, IR_CALL)->d;
+  }
+
+  int lhs = lower_expr(node->lhs);
+
+  // 右辺が32ビットに収まる定数なら即値オペランドにする
+  if (node->rhs->kind == ND_NUM && node->kind != ND_DIV &&
+      node->kind != ND_PTR_DIFF) {
+    long imm = node->rhs->val;
+    IROp op;
+    switch (node->kind) {
+      case ND_PTR_ADD:
+      case ND_PTR_SUB:
+        imm *= node->ty->base->size;
+        op = node->kind == ND_PTR_ADD ? IR_ADD : IR_SUB;
+        break;
+      case ND_ADD:
+        op = IR_ADD;
+        break;
+      case ND_SUB:
+        op = IR_SUB;
+        break;
+      case ND_MUL:
+        op = IR_MUL;
+        break;
+      case ND_EQ:
+        op = IR_EQ;
+        break;
+      case ND_NE:
+        op = IR_NE;
+        break;
+      case ND_LT:
+        op = IR_LT;
+        break;
+      case ND_LE:
+        op = IR_LE;
+        break;
+    }
+    if (imm == (int)imm) return emit_binop_imm(op, lhs, imm);
+  }
+
+  int rhs = lower_expr(node->rhs);
+
+  switch (node->kind) {
+    case ND_ADD:
+      return emit_binop(IR_ADD, lhs, rhs);
+    case ND_SUB:
+      return emit_binop(IR_SUB, lhs, rhs);
+    case ND_PTR_ADD: {
+      // 要素の大きさが1, 2, 4, 8なら乗算せずにアドレッシングモードで計算する
+      int size = node->ty->base->size;
+      if (size == 1 || size == 2 || size == 4 || size == 8) {
+        IR *ir = new_ir(IR_LEA);
+        ir->d = new_vreg();
+        ir->a = lhs;
+        ir->b = rhs;
+        ir->imm = size;
+        return ir->d;
+      }
+      rhs = emit_binop(IR_MUL, rhs, emit_imm(size));
+      return emit_binop(IR_ADD, lhs, rhs);
+    }
+    case ND_PTR_SUB:
+      rhs = emit_binop(IR_MUL, rhs, emit_imm(node->ty->base->size));
+      return emit_binop(IR_SUB, lhs, rhs);
+    case ND_PTR_DIFF: {
+      int diff = emit_binop(IR_SUB, lhs, rhs);
+      return emit_binop(IR_DIV, diff, emit_imm(node->lhs->ty->base->size));
+    }
+    case ND_MUL:
+      return emit_binop(IR_MUL, lhs, rhs);
+    case ND_DIV:
+      return emit_binop(IR_DIV, lhs, rhs);
+    case ND_EQ:
+      return emit_binop(IR_EQ, lhs, rhs);
+    case ND_NE:
+      return emit_binop(IR_NE, lhs, rhs);
+    case ND_LT:
+      return emit_binop(IR_LT, lhs, rhs);
+    case ND_LE:
+      return emit_binop(IR_LE, lhs, rhs);
+  }
+
+  error_tok(node->tok, "invalid expression");
+}
+
+//
+// ループの最適化
+//
+// ループの制御変数(帰納変数)は、アドレスを取られていなければ、ループの間だけ
+// 仮想レジスタに置いて読み書きし、ループを抜けたところでメモリに書き戻す。
+// ループの中で添字に使われる配列のアドレスはループ不変なので、ループの前で
+// 一度だけ計算する。
+//
+
+static bool can_promote(Var *var) {
+  return var->is_local && var->ty->kind == TY_INT && !var->addr_taken;
+}
+
+// 部分木にvarへの代入があるか
+static bool assigns(Node *node, Var *var) {
+  for (; node; node = node->next) {
+    if (node->kind == ND_ASSIGN && node->lhs->kind == ND_VAR &&
+        node->lhs->var == var)
+      return true;
+    Node **slots[MAX_NODE_SLOTS];
+    int nslots = node_slots(node, slots);
+    for (int i = 0; i < nslots; i++)
+      if (assigns(*slots[i], var)) return true;
+  }
+  return false;
+}
+
+// forなら増分で代入される変数、whileなら条件で比べられ本体で代入される変数
+static Var *loop_iv(Node *node) {
+  if (node->kind == ND_FOR) {
+    Node *inc = node->inc;
+    if (inc && inc->kind == ND_EXPR_STMT && inc->lhs->kind == ND_ASSIGN &&
+        inc->lhs->lhs->kind == ND_VAR && can_promote(inc->lhs->lhs->var))
+      return inc->lhs->lhs->var;
+    return NULL;
+  }
+
+  // 条件が常に真のwhileは、pruneが条件をNULLにしている
+  Node *cond = node->cond;
+  if (!cond || !cond_cc(cond->kind, false)) return NULL;
+  Node *ops[] = {cond->lhs, cond->rhs};
+  for (int i = 0; i < 2; i++)
+    if (ops[i]->kind == ND_VAR && can_promote(ops[i]->var) &&
+        assigns(node->then, ops[i]->var))
+      return ops[i]->var;
+  return NULL;
+}
+
+// 部分木で添字に使われる配列を集める
+static void find_indexed(Node *node, Var **vars, int *n) {
+  for (; node; node = node->next) {
+    if (node->kind == ND_PTR_ADD && node->lhs->kind == ND_VAR &&
+        node->lhs->ty->kind == TY_ARRAY && node->rhs->kind != ND_NUM) {
+      Var *var = node->lhs->var;
+      bool seen = find_promoted(var, true);
+      for (int i = 0; i < *n; i++) seen |= vars[i] == var;
+      if (!seen && *n < MAX_HOISTED_ARRAYS) vars[(*n)++] = var;
+    }
+
+    Node **slots[MAX_NODE_SLOTS];
+    int nslots = node_slots(node, slots);
+    for (int i = 0; i < nslots; i++) find_indexed(*slots[i], vars, n);
+  }
+}
+
+static void promote(Var *var, bool addr, int vreg) {
+  promoted[npromoted++] = (Promoted){var, addr, vreg};
+}
+
+// ループの前に置く命令を出し、ループの間レジスタに置く値を登録する
+static void enter_loop(Node *node) {
+  Var *iv = loop_iv(node);
+  if (iv && npromoted < MAX_PROMOTED) {
+    Node var = {.kind = ND_VAR, .var = iv, .ty = iv->ty, .tok = node->tok};
+    int v = new_vreg();
+    emit_mov(v, lower_expr(&var));
+    promote(iv, false, v);
+  }
+
+  Var *arrays[MAX_HOISTED_ARRAYS];
+  int narrays = 0;
+  find_indexed(node->cond, arrays, &narrays);
+  find_indexed(node->then, arrays, &narrays);
+  find_indexed(node->inc, arrays, &narrays);
+  for (int i = 0; i < narrays && npromoted < MAX_PROMOTED; i++) {
+    Node var = {.kind = ND_VAR, .var = arrays[i], .ty = arrays[i]->ty};
+    promote(arrays[i], true, lower_addr(&var));
+  }
+}
+
+// ループを抜けたところで帰納変数を書き戻し、レジスタに置いた値を解放する
+static void leave_loop(int mark) {
+  int keep[MAX_PROMOTED];
+  int nkeep = 0;
+
+  while (npromoted > mark) {
+    Promoted p = promoted[--npromoted];
+    if (p.addr) {
+      keep[nkeep++] = p.vreg;
+      continue;
+    }
+
+    // 外側のループでもレジスタに置いていれば、そちらに移す
+    Promoted *outer = find_promoted(p.var, false);
+    if (outer) {
+      emit_mov(outer->vreg, p.vreg);
+      continue;
+    }
+
+    Node var = {.kind = ND_VAR, .var = p.var, .ty = p.var->ty};
+    int addr = lower_addr(&var);
+    IR *ir = new_ir(IR_STORE);
+    ir->a = addr;
+    ir->b = p.vreg;
+    ir->size = p.var->ty->size;
+  }
+
+  // アドレスはループの途中で最後に使われても、次の繰り返しで使うので
+  // ループを抜けるまで生かしておく
+  if (nkeep) {
+    IR *ir = new_ir(IR_KEEP);
+    memcpy(ir->args, keep, sizeof(int) * nkeep);
+    ir->nargs = nkeep;
+  }
+}
+
+// var += val
+static void add_to_var(Var *var, int val) {
+  Promoted *p = find_promoted(var, false);
+  if (p) {
+    emit_mov(p->vreg, emit_binop(IR_ADD, p->vreg, val));
+    return;
+  }
+
+  Node node = {.kind = ND_VAR, .var = var, .ty = var->ty};
+  int addr = lower_addr(&node);
+  int sum = emit_binop(IR_ADD, emit_load(addr, var->ty), val);
+  IR *ir = new_ir(IR_STORE);
+  ir->a = addr;
+  ir->b = sum;
+  ir->size = var->ty->size;
+}
+
+// ベクトル化できるループなら、ループの前にベクトル命令で処理する部分を置く。
+// 帰納変数は処理し終えた要素の次まで進むので、残りは元のループが処理する
+static void lower_vec_loop(Node *node, int seq) {
+  Var *iv = loop_iv(node);
+  Promoted *p = iv ? find_promoted(iv, false) : NULL;
+  VecLoop vl;
+  if (!p || !match_vec_loop(node, iv, &vl)) return;
+
+  int bound = lower_expr(vl.bound);
+  int bases[MAX_VEC_ARRAYS];
+  for (int i = 0; i < vl.narrays; i++) {
+    Node var = {.kind = ND_VAR, .var = vl.arrays[i], .ty = vl.arrays[i]->ty};
+    bases[i] = lower_expr(&var);
+  }
+  int sum = vl.sum ? new_vreg() : 0;
+
+  IR *ir = new_ir(IR_VLOOP);
+  ir->d = sum;
+  ir->a = p->vreg;
+  ir->b = bound;
+  ir->label = seq;
+  memcpy(ir->args, bases, sizeof(int) * vl.narrays);
+  ir->nargs = vl.narrays;
+  ir->vloop = malloc(sizeof(VecLoop));
+  *ir->vloop = vl;
+  gen_ctx->vec_loops++;
+
+  if (sum) add_to_var(vl.sum, sum);
+}
+
+static void lower_stmt(Node *node) {
+  if (is_tail_call(node)) {
+    lower_call(node->lhs, IR_TAILCALL);
+    gen_ctx->tail_calls++;
+    return;
+  }
+
+  switch (node->kind) {
+    case ND_NULL:
+      return;
+    case ND_EXPR_STMT:
+      lower_expr(node->lhs);
+      return;
+    case ND_RETURN: {
+      int val = lower_expr(node->lhs);
+      new_ir(IR_RET)->a = val;
+      return;
+    }
+    case ND_IF: {
+      int seq = gen_ctx->labelseq++;
+      if (node->els) {
+        emit_branch(node->cond, false, "else", seq);
+        lower_stmt(node->then);
+        emit_jmp("end", seq);
+        emit_label("else", seq);
+        lower_stmt(node->els);
+      } else {
+        emit_branch(node->cond, false, "end", seq);
+        lower_stmt(node->then);
+      }
+      emit_label("end", seq);
+      return;
+    }
+    case ND_WHILE:
+    case ND_FOR: {
+      // 条件を末尾に置いたループ。最初は条件の判定へ飛び込む
+      int seq = gen_ctx->labelseq++;
+      if (node->init) lower_stmt(node->init);
+      int mark = npromoted;
+      enter_loop(node);
+      if (opt_vectorize) lower_vec_loop(node, seq);
+      emit_jmp("cond", seq);
+      emit_label("begin", seq);
+      if (opt_instrument) new_ir(IR_COUNT)->label = loop_id(node);
+      lower_stmt(node->then);
+      if (node->inc) lower_stmt(node->inc);
+      emit_label("cond", seq);
+      if (node->cond)
+        emit_branch(node->cond, true, "begin", seq);
+      else
+        emit_jmp("begin", seq);
+      leave_loop(mark);
+      return;
+    }
+    case ND_BLOCK:
+      for (Node *n = node->body; n; n = n->next) lower_stmt(n);
+      return;
+  }
+
+  error_tok(node->tok, "invalid statement");
+}
+
+//
+// アセンブリの出力
+//
+
+// 仮想レジスタのオペランド表記。スピルしていればスタック上のスロットになる
+static char *opd(int v) {
+  static _Thread_local char buf[4][32];
+  static _Thread_local int idx;
+
+  if (irf->reg[v] >= 0) return regs[irf->reg[v]];
+  char *p = buf[idx++ % 4];
+  sprintf(p, "[rbp-%d]", irf->spill[v]);
+  return p;
+}
+
+static bool in_reg(int v) { return irf->reg[v] >= 0; }
+
+// 二項演算の右辺。即値の場合はその数値になる
+static char *rhs_opd(IR *ir) {
+  static _Thread_local char buf[32];
+  if (ir->b) return opd(ir->b);
+  sprintf(buf, "%ld", ir->imm);
+  return buf;
+}
+
+static void emit_mov_from_rax(int d) { emit("  mov %s, rax\n", opd(d)); }
+
+static void emit_binary(char *insn, IR *ir) {
+  emit("  mov rax, %s\n", opd(ir->a));
+  emit("  %s rax, %s\n", insn, rhs_opd(ir));
+  emit_mov_from_rax(ir->d);
+}
+
+static void emit_cmp(char *setcc, IR *ir) {
+  emit("  mov rax, %s\n", opd(ir->a));
+  emit("  cmp rax, %s\n", rhs_opd(ir));
+  emit("  %s al\n", setcc);
+  emit_lit("  movzb rax, al\n");
+  emit_mov_from_rax(ir->d);
+}
+
+// プロローグで退避した呼び出し先保存レジスタを戻す
+static void emit_restore(void) {
+  for (int i = 0; i < irf->nsaved; i++)
+    emit("  mov %s, [rbp-%d]\n", regs[irf->callee_saved[i]],
+         irf->fn->stack_size + (i + 1) * 8);
+}
+
+static void emit_ins(IR *ir) {
+  char *funcname = irf->fn->name;
+
+  switch (ir->op) {
+    case IR_IMM:
+      if (in_reg(ir->d)) {
+        emit("  mov %s, %ld\n", opd(ir->d), ir->imm);
+      } else {
+        emit("  mov rax, %ld\n", ir->imm);
+        emit_mov_from_rax(ir->d);
+      }
+      return;
+    case IR_ADD:
+      emit_binary("add", ir);
+      return;
+    case IR_SUB:
+      emit_binary("sub", ir);
+      return;
+    case IR_MUL:
+      emit_binary("imul", ir);
+      return;
+    case IR_SHL:
+      emit_binary("shl", ir);
+      return;
+    case IR_MOV:
+      if (ir->d == ir->a) return;
+      if (in_reg(ir->d) || in_reg(ir->a)) {
+        emit("  mov %s, %s\n", opd(ir->d), opd(ir->a));
+      } else {
+        emit("  mov rax, %s\n", opd(ir->a));
+        emit_mov_from_rax(ir->d);
+      }
+      return;
+    case IR_LEA: {
+      // ベースとインデックスはレジスタでなければならない
+      char *base = "rax";
+      char *index = "rdi";
+      if (in_reg(ir->a))
+        base = opd(ir->a);
+      else
+        emit("  mov rax, %s\n", opd(ir->a));
+      if (in_reg(ir->b))
+        index = opd(ir->b);
+      else
+        emit("  mov rdi, %s\n", opd(ir->b));
+
+      char *d = in_reg(ir->d) ? opd(ir->d) : "rax";
+      emit("  lea %s, [%s+%s*%ld]\n", d, base, index, ir->imm);
+      if (!in_reg(ir->d)) emit_mov_from_rax(ir->d);
+      return;
+    }
+    case IR_NEG:
+      emit("  mov rax, %s\n", opd(ir->a));
+      emit_lit("  neg rax\n");
+      emit_mov_from_rax(ir->d);
+      return;
+    case IR_DIV:
+      emit("  mov rax, %s\n", opd(ir->a));
+      emit("  mov rdi, %s\n", opd(ir->b));
+      emit_lit("  cqo\n");
+      emit_lit("  idiv rdi\n");
+      emit_mov_from_rax(ir->d);
+      return;
+    case IR_EQ:
+      emit_cmp("sete", ir);
+      return;
+    case IR_NE:
+      emit_cmp("setne", ir);
+      return;
+    case IR_LT:
+      emit_cmp("setl", ir);
+      return;
+    case IR_LE:
+      emit_cmp("setle", ir);
+      return;
+    case IR_LVAR:
+      if (in_reg(ir->d)) {
+        emit("  lea %s, [rbp-%d]\n", opd(ir->d), ir->var->offset);
+      } else {
+        emit("  lea rax, [rbp-%d]\n", ir->var->offset);
+        emit_mov_from_rax(ir->d);
+      }
+      return;
+    case IR_GVAR:
+      if (in_reg(ir->d)) {
+        emit("  mov %s, offset %s\n", opd(ir->d), ir->var->name);
+      } else {
+        emit("  mov rax, offset %s\n", ir->var->name);
+        emit_mov_from_rax(ir->d);
+      }
+      return;
+    case IR_LOAD: {
+      char *base = "rax";
+      if (in_reg(ir->a))
+        base = opd(ir->a);
+      else
+        emit("  mov rax, %s\n", opd(ir->a));
+
+      if (ir->size == 1)
+        emit("  movsx rax, byte ptr [%s]\n", base);
+      else
+        emit("  mov rax, [%s]\n", base);
+      emit_mov_from_rax(ir->d);
+      return;
+    }
+    case IR_STORE:
+      emit("  mov rax, %s\n", opd(ir->a));
+      emit("  mov rdi, %s\n", opd(ir->b));
+      if (ir->size == 1)
+        emit_lit("  mov [rax], dil\n");
+      else
+        emit_lit("  mov [rax], rdi\n");
+      return;
+    case IR_LABEL:
+      emit(".L.%s.%s.%d:\n", ir->lname, funcname, ir->label);
+      return;
+    case IR_JMP:
+      emit("  jmp .L.%s.%s.%d\n", ir->lname, funcname, ir->label);
+      return;
+    case IR_BCMP:
+      // 両方がメモリにあるとcmpできないので、左辺をraxに移す
+      if (in_reg(ir->a)) {
+        emit("  cmp %s, %s\n", opd(ir->a), rhs_opd(ir));
+      } else {
+        emit("  mov rax, %s\n", opd(ir->a));
+        emit("  cmp rax, %s\n", rhs_opd(ir));
+      }
+      emit("  j%s .L.%s.%s.%d\n", ir->cc, ir->lname, funcname, ir->label);
+      return;
+    case IR_CALL:
+      // 引数は割り当て対象外のレジスタに入れるので、順番に移すだけでよい
+      for (int i = 0; i < ir->nargs; i++)
+        emit("  mov %s, %s\n", argreg8[i], opd(ir->args[i]));
+
+      // フレームは16バイト境界に揃えてあり、push/popもしないので
+      // RSPのアラインメントを実行時に調べる必要はない
+      emit_lit("  mov rax, 0\n");
+      emit("  call %s\n", ir->funcname);
+      emit_mov_from_rax(ir->d);
+      return;
+    case IR_TAILCALL:
+      for (int i = 0; i < ir->nargs; i++)
+        emit("  mov %s, %s\n", argreg8[i], opd(ir->args[i]));
+
+      // 自分自身なら、退避したレジスタもフレームもそのまま使い回す
+      if (!strcmp(ir->funcname, funcname)) {
+        emit("  jmp .L.tail.%s\n", funcname);
+        return;
+      }
+      emit_restore();
+      emit_lit("  mov rsp, rbp\n");
+      emit_lit("  pop rbp\n");
+      emit_lit("  mov rax, 0\n");
+      emit("  jmp %s\n", ir->funcname);
+      return;
+    case IR_RET:
+      emit("  mov rax, %s\n", opd(ir->a));
+      emit("  jmp .L.return.%s\n", funcname);
+      return;
+    case IR_KEEP:
+      return;
+    case IR_COUNT:
+      emit_loop_count(ir->label);
+      return;
+    case IR_VLOOP: {
+      // 配列のアドレスがスピルしていれば、空いているレジスタに移す
+      static char *scratch[] = {"rsi", "rdx", "rcx", "r8", "r9"};
+      char *bases[MAX_VEC_ARRAYS];
+      for (int i = 0; i < ir->nargs; i++) {
+        if (in_reg(ir->args[i])) {
+          bases[i] = opd(ir->args[i]);
+        } else {
+          bases[i] = scratch[i];
+          emit("  mov %s, %s\n", scratch[i], opd(ir->args[i]));
+        }
+      }
+
+      emit("  mov rax, %s\n", opd(ir->a));
+      emit("  mov rdi, %s\n", opd(ir->b));
+      emit_vec_loop(ir->vloop, bases, funcname, ir->label);
+      emit_mov_from_rax(ir->a);
+      if (ir->d) emit("  mov %s, rdi\n", opd(ir->d));
+      return;
+    }
+  }
+}
+
+static void load_arg(Var *var, int idx) {
+  if (var->ty->size == 1)
+    emit("  mov [rbp-%d], %s\n", var->offset, argreg1[idx]);
+  else
+    emit("  mov [rbp-%d], %s\n", var->offset, argreg8[idx]);
+}
+
+// 変換中の状態を捨てる。--serverでは前の要求がエラーで途中から抜けている
+void reset_ir(void) {
+  irf = NULL;
+  npromoted = 0;
+}
+
+// 関数をIRに変換してレジスタを割り当て、プロローグからエピローグまでを出力する
+void gen_ir(Function *fn) {
+  IRFunc f = {};
+  f.fn = fn;
+  irf = &f;
+  npromoted = 0;  // 前の関数がループの変換中にエラーで抜けていても空にする
+
+  for (Node *node = fn->node; node; node = node->next) lower_stmt(node);
+  alloc_regs(&f);
+
+  // Prologue
+  emit_lit("  push rbp\n");
+  emit_lit("  mov rbp, rsp\n");
+  emit("  sub rsp, %d\n", f.frame_size);
+  for (int i = 0; i < f.nsaved; i++)
+    emit("  mov [rbp-%d], %s\n", fn->stack_size + (i + 1) * 8,
+           regs[f.callee_saved[i]]);
+
+  // 自分自身の末尾呼び出しは、引数をレジスタに入れてここへ戻ってくる
+  for (int i = 0; i < f.len; i++) {
+    if (f.ins[i].op == IR_TAILCALL && !strcmp(f.ins[i].funcname, fn->name)) {
+      emit(".L.tail.%s:\n", fn->name);
+      break;
+    }
+  }
+
+  int i = 0;
+  for (VarList *vl = fn->params; vl; vl = vl->next) load_arg(vl->var, i++);
+  if (opt_instrument) emit_entry_count();
+
+  for (int i = 0; i < f.len; i++) emit_ins(&f.ins[i]);
+
+  // Epilogue
+  emit(".L.return.%s:\n", fn->name);
+  emit_restore();
+  emit_lit("  mov rsp, rbp\n");
+  emit_lit("  pop rbp\n");
+  emit_lit("  ret\n");
+
+  for (int i = 0; i < f.len; i++)
+    if (f.ins[i].op == IR_VLOOP) free(f.ins[i].vloop);
+  free(f.ins);
+  free(f.reg);
+  free(f.spill);
+  irf = NULL;
+}
@@ -0,0 +1,38 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// スタックフレームの配置。ローカル変数にRBPからのオフセットを割り当てる。
+// 変数はその型のアラインメントに揃え、ブロックの中ではアラインメントの
+// 大きい順に詰めて隙間を作らない。
+// 兄弟のブロック同士はスコープが重ならないので、親のブロックの変数の直後から
+// 同じ領域を使い回す。フレームの大きさは最も深く積んだところで決まる。
+//
+
+// 扱うアラインメントの最大値
+#define MAX_ALIGN 16
+
+// bsの変数をoffsetより下に配置し、内側のブロックも含めて使った最大の
+// オフセットを返す
+static int layout_block(BlockScope *bs, int offset) {
+  // 同じアラインメントの変数は、これまでどおり宣言と逆の順に並べる
+  for (int align = MAX_ALIGN; align >= 1; align /= 2) {
+    for (VarList *vl = bs->vars; vl; vl = vl->next) {
+      Var *var = vl->var;
+      if (var->ty->align != align) continue;
+      offset = align_to(offset + var->ty->size, align);
+      var->offset = offset;
+    }
+  }
+
+  int end = offset;
+  for (BlockScope *child = bs->children; child; child = child->next) {
+    int n = layout_block(child, offset);
+    if (end < n) end = n;
+  }
+  return end;
+}
+
+void layout_frame(Function *fn) {
+  fn->stack_size = align_to(layout_block(fn->scope, 0), 8);
+}
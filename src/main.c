@@ -1,21 +1,43 @@
 #include "./9cc.h"
 
-// 指定されたファイルの内容を返す
-static char *read_file(char *path) {
-  // ファイルを開く
-  FILE *fp = fopen(path, "r");
-  if (!fp) error("cannot open %s: %s", path, strerror(errno));
+// 最適化レベル。0はスタックマシン、1以上はレジスタ割り当てを行うバックエンド
+int opt_level;
 
-  int filemax = 10 * 1024 * 1024;
-  char *buf = malloc(filemax);
-  int size = fread(buf, 1, filemax - 2, fp);
-  if (!feof(fp)) error("%s: file too large");
+// 使うスレッドの数 (-j)。入力ファイルが1つなら関数のコード生成に、
+// 複数ならファイルを同時にコンパイルするのに使う
+int opt_jobs = 1;
 
-  // ファイルが必ず"\n\0"で終わっているようにする
-  if (size == 0 || buf[size - 1] != '\n') buf[size++] = '\n';
-  buf[size] = '\0';
-  return buf;
-}
+// 出力したアセンブリに覗き穴最適化をかけるか。
+// -fpeephole/-fno-peephole がなければ-O1以上でかける
+bool opt_peephole;
+static int peephole_flag = -1;
+
+// -finline-limit=N がなければ、-O1以上で使う上限
+#define DEFAULT_INLINE_LIMIT 30
+static int inline_limit_flag = -1;
+
+// -fvectorize/-fno-vectorize がなければ-O1以上でベクトル化する
+static int vectorize_flag = -1;
+
+// -foptimize-sibling-calls/-fno-optimize-sibling-calls がなければ
+// -O1以上で末尾呼び出しをjmpにする
+static int tail_calls_flag = -1;
+
+static bool opt_mem_stats;
+static bool opt_stats;
+static bool opt_stats_json;
+static bool opt_time_report;
+static bool opt_c;
+static char *opt_o;
+
+static char **input_files;
+static int ninput_files;
+
+// 計測結果の出力が翻訳単位の間で混ざらないようにする
+static pthread_mutex_t report_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// --keep-goingでエラーを報告した翻訳単位があったか
+static atomic_bool failed;
 
 int align_to(int n, int align) {
   // 10 = 1010
@@ -24,30 +46,315 @@ int align_to(int n, int align) {
   return (n + align - 1) & ~(align - 1);
 }
 
-int main(int argc, char **argv) {
-  if (argc != 2) error("%s: 引数の個数が正しくありません", argv[0]);
+static void usage(char *argv0) {
+  error("usage: %s [-O0|-O1] [-f[no-]peephole] [-finline-limit=<n>|-fno-inline]\n"
+        "       [-f[no-]vectorize] [-f[no-]optimize-sibling-calls] [-finstrument] [-mavx2] [-j <n>] [-c] [-o <path>] [--cache-dir <dir>] [--mem-stats]\n"
+        "       [--stats[=json]] [--time-report] [--keep-going] [--stream-tokens] <file>...\n"
+        "       %s --server <socket>\n"
+        "       %s --connect <socket> <args>...", argv0, argv0, argv0);
+}
+
+// --serverでは要求ごとに引数を解析し直すので、オプションを既定値に戻す
+static void reset_args(void) {
+  opt_level = 0;
+  opt_jobs = 1;
+  peephole_flag = -1;
+  inline_limit_flag = -1;
+  opt_inline_limit = 0;
+  vectorize_flag = -1;
+  tail_calls_flag = -1;
+  opt_instrument = false;
+  opt_avx2 = false;
+  opt_mem_stats = false;
+  opt_stats = false;
+  opt_stats_json = false;
+  opt_time_report = false;
+  opt_keep_going = false;
+  opt_stream_tokens = false;
+  opt_c = false;
+  opt_o = NULL;
+  cache_dir = NULL;
+  ninput_files = 0;
+}
+
+// コマンドライン引数を解析する
+static void parse_args(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-O0")) {
+      opt_level = 0;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-O1") || !strcmp(argv[i], "-O")) {
+      opt_level = 1;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fpeephole")) {
+      peephole_flag = 1;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-peephole")) {
+      peephole_flag = 0;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-finline-limit=", 15)) {
+      char *end;
+      inline_limit_flag = strtol(argv[i] + 15, &end, 10);
+      if (*end || end == argv[i] + 15 || inline_limit_flag < 0)
+        error("invalid inline limit: %s", argv[i] + 15);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-inline")) {
+      inline_limit_flag = 0;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fvectorize")) {
+      vectorize_flag = 1;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-vectorize")) {
+      vectorize_flag = 0;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-foptimize-sibling-calls")) {
+      tail_calls_flag = 1;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-optimize-sibling-calls")) {
+      tail_calls_flag = 0;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-finstrument")) {
+      opt_instrument = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-mavx2")) {
+      opt_avx2 = true;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-j", 2)) {
+      char *arg = argv[i] + 2;
+      if (!*arg) {
+        if (++i == argc) usage(argv[0]);
+        arg = argv[i];
+      }
+
+      char *end;
+      opt_jobs = strtol(arg, &end, 10);
+      if (*end || opt_jobs < 1) error("invalid number of jobs: %s", arg);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-c")) {
+      opt_c = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-o")) {
+      if (++i == argc) usage(argv[0]);
+      opt_o = argv[i];
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-o", 2)) {
+      opt_o = argv[i] + 2;
+      continue;
+    }
 
+    if (!strcmp(argv[i], "--stats") || !strcmp(argv[i], "--stats=json")) {
+      opt_stats = true;
+      opt_stats_json = argv[i][7] == '=';
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--time-report")) {
+      opt_time_report = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--cache-dir")) {
+      if (++i == argc) usage(argv[0]);
+      cache_dir = argv[i];
+      continue;
+    }
+
+    if (!strncmp(argv[i], "--cache-dir=", 12)) {
+      cache_dir = argv[i] + 12;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--keep-going")) {
+      opt_keep_going = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--stream-tokens")) {
+      opt_stream_tokens = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--mem-stats")) {
+      opt_mem_stats = true;
+      continue;
+    }
+
+    if (argv[i][0] == '-' && argv[i][1] != '\0')
+      error("unknown argument: %s", argv[i]);
+
+    input_files = realloc(input_files, sizeof(char *) * (ninput_files + 1));
+    input_files[ninput_files++] = argv[i];
+  }
+
+  if (!ninput_files) usage(argv[0]);
+  if (opt_o && ninput_files > 1)
+    error("cannot specify -o with multiple input files");
+
+  opt_peephole = peephole_flag < 0 ? opt_level >= 1 : peephole_flag;
+  if (inline_limit_flag >= 0)
+    opt_inline_limit = inline_limit_flag;
+  else if (opt_level >= 1)
+    opt_inline_limit = DEFAULT_INLINE_LIMIT;
+
+  // ベクトル化したループはIRのバックエンドでしか生成できない
+  opt_vectorize = opt_level >= 1 && vectorize_flag != 0;
+
+  // -finstrumentでは元の関数とループの実行回数を数えたいので、展開した関数の
+  // 呼び出しやまとめて処理した要素が数えられなくなる最適化はしない
+  if (opt_instrument) {
+    opt_inline_limit = 0;
+    opt_vectorize = false;
+  }
+  opt_tail_calls = tail_calls_flag < 0 ? opt_level >= 1 : tail_calls_flag;
+}
+
+// -oがなければ、オブジェクトファイルは入力ファイル名の拡張子を.oに変えた
+// ファイルに書き出す。アセンブリは標準出力に書き出すが、入力ファイルが
+// 複数あれば拡張子を.sに変えたファイルに書き出す。返す文字列は新しく確保する
+static char *output_path(char *filename) {
+  if (opt_o) return strdup(opt_o);
+  if ((!opt_c && ninput_files == 1) || !strcmp(filename, "-"))
+    return strdup("-");
+
+  char *base = strrchr(filename, '/');
+  base = base ? base + 1 : filename;
+  char *dot = strrchr(base, '.');
+  int len = dot ? dot - base : strlen(base);
+
+  char *path = calloc(1, len + 3);
+  sprintf(path, "%.*s.%c", len, base, opt_c ? 'o' : 's');
+  return path;
+}
+
+// 翻訳単位を1つコンパイルする。tuはtになっている
+static void compile(TU *t) {
   // トークナイズしてパースする
   // 結果はcodeに保存される
-  filename = argv[1];
-  user_input = read_file(argv[1]);
-  token = tokenize();
+  start_phase(PH_READ);
+  if (!t->user_input) t->user_input = read_file(t->filename);
+  // --stream-tokensでは、字句解析の時間はほとんどパースの時間に入る
+  start_phase(PH_TOKENIZE);
+  tokenize();
+  start_phase(PH_PARSE);
   Program *prog = program();
 
-  // ローカル変数の個数分オフセット(メモリ領域)を割り当てる
-  for (Function *fn = prog->fns; fn; fn = fn->next) {
-    int offset = 0;
-    for (VarList *vl = fn->locals; vl; vl = vl->next) {
-      Var *var = vl->var;
-      offset += var->ty->size;
-      var->offset = offset;
-    }
-
-    fn->stack_size = align_to(offset, 8);
+  // --keep-goingで報告したエラーがあれば、コードは生成しない
+  if (t->nerrors) {
+    fprintf(stderr, "%s: %d error%s generated\n", t->filename, t->nerrors,
+            t->nerrors > 1 ? "s" : "");
+    failed = true;
+    return;
   }
 
+  if (cache_enabled()) hash_functions(prog);
+  start_phase(PH_OPTIMIZE);
+  if (opt_inline_limit) inline_functions(prog);
+  if (opt_level >= 1) optimize(prog);
+
+  // ローカル変数にオフセット(メモリ領域)を割り当てる
+  start_phase(PH_LAYOUT);
+  for (Function *fn = prog->fns; fn; fn = fn->next) layout_frame(fn);
+
   // ASTをトラバースしてアセンブリを出す
+  start_phase(PH_CODEGEN);
+  open_output();
   codegen(prog);
+  close_output();
+  end_phase();
+
+  if (!opt_stats && !opt_time_report && !opt_mem_stats) return;
+  pthread_mutex_lock(&report_lock);
+  if (opt_stats || opt_time_report)
+    print_stats(stderr, opt_stats, opt_stats_json);
+  if (opt_mem_stats) print_mem_stats(stderr);
+  pthread_mutex_unlock(&report_lock);
+}
+
+// --serverで要求を1つ処理し、終了ステータスを返す。
+// 翻訳単位は要求の間で使い回す。致命的なエラーは要求を打ち切るだけにするため、
+// コード生成は(別のスレッドからは戻れないので)-jによらず1スレッドで行う
+static int handle_request(Request *req) {
+  static TU *t;
+  if (t)
+    reset_tu(t);
+  else
+    t = new_tu(NULL, NULL, false);
+  reset_types();
+  reset_args();
+  failed = false;
+
+  // 前の要求がコード生成中にエラーで抜けていれば、状態が残っている
+  gen_ctx = NULL;
+  emit_buf = NULL;
+  reset_ir();
+
+  jmp_buf fatal;
+  tu = t;
+  t->fatal = &fatal;
+  if (setjmp(fatal)) {
+    tu = NULL;
+    return 1;
+  }
+
+  parse_args(req->argc, req->argv);
+  if (ninput_files > 1) error("--server: only one input file per request");
+  collect_stats = opt_stats;
+  t->filename = input_files[0];
+  t->object = opt_c;
+  if (!strcmp(t->filename, "-")) t->user_input = req->input;
+  req->out_path = output_path(t->filename);
+  req->out = &t->out;
+
+  compile(t);
+  tu = NULL;
+  return failed;
+}
+
+int main(int argc, char **argv) {
+  if (argc == 3 && !strcmp(argv[1], "--server")) {
+    cache_in_memory = true;
+    serve(argv[2], handle_request);
+  }
+  if (argc >= 3 && !strcmp(argv[1], "--connect"))
+    return connect_server(argv[2], argc - 3, argv + 3);
+
+  parse_args(argc, argv);
+  collect_stats = opt_stats;
 
-  return 0;
+  TU **tus = calloc(ninput_files, sizeof(TU *));
+  for (int i = 0; i < ninput_files; i++)
+    tus[i] = new_tu(input_files[i], output_path(input_files[i]), opt_c);
+  compile_all(tus, ninput_files, opt_jobs, compile);
+  free(tus);
+  return failed;
 }
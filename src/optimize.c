@@ -0,0 +1,375 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// 型付け(add_type)が終わった構文木に対する最適化パス。
+// 定数の部分木をND_NUMに畳み込み、x*1やx+0などの恒等式を簡約する。
+// ノードはその場で書き換えるので、親や`next`のリンクはそのまま使える。
+//
+// 畳み込んだ後で、到達しない文を取り除く。条件が定数のif/while/forは
+// 通る側だけを残し、returnなど後ろに制御が移らない文より後ろの文は捨てる。
+// breakやgotoはないので、条件のないループからも抜けるのはreturnだけである。
+// 最後に、どこからも参照されなくなったローカル変数をスコープから外し
+// (フレームが小さくなる)、参照されない文字列リテラルを出力しない。
+// ユーザが定義したグローバル変数は、ほかの翻訳単位から参照されうるので残す。
+//
+
+static void fold(Node *node);
+
+static bool is_num(Node *node, long val) {
+  return node->kind == ND_NUM && node->val == val;
+}
+
+// 副作用がなく、評価を省略しても安全な式か
+static bool is_pure(Node *node) {
+  if (!node) return true;
+  switch (node->kind) {
+    case ND_ASSIGN:
+    case ND_FUNCALL:
+    case ND_STMT_EXPR:
+      return false;
+  }
+
+  Node **slots[MAX_NODE_SLOTS];
+  int nslots = node_slots(node, slots);
+  for (int i = 0; i < nslots; i++)
+    if (!is_pure(*slots[i])) return false;
+  return true;
+}
+
+// xが2のべき乗ならその指数、そうでなければ-1を返す
+static int log2_of(long x) {
+  if (x <= 0 || (x & (x - 1))) return -1;
+  int n = 0;
+  while (x > 1) {
+    x >>= 1;
+    n++;
+  }
+  return n;
+}
+
+// ノードを整数リテラルに置き換える。valはlhsと同じ場所にある
+static void to_num(Node *node, long val) {
+  node->kind = ND_NUM;
+  node->ty = int_type;
+  node->val = val;
+}
+
+// ノードを別のノードで置き換える。文のリストをつなぐ`next`は残す。
+// 置き換えるのは式のノードか、if/while/for(最も大きいノード)なので、
+// withの大きさはnodeの大きさを超えない
+static void replace(Node *node, Node *with) {
+  Node *next = node->next;
+  memcpy(node, with, node_size(with->kind));
+  node->next = next;
+}
+
+// 両辺が定数の二項演算を計算する。計算できなければfalseを返す
+static bool eval(Node *node, long *val) {
+  // オーバーフローしたときに未定義動作にならないよう符号なしで計算する
+  unsigned long l = node->lhs->val;
+  unsigned long r = node->rhs->val;
+
+  switch (node->kind) {
+    case ND_ADD:
+      *val = l + r;
+      return true;
+    case ND_SUB:
+      *val = l - r;
+      return true;
+    case ND_MUL:
+      *val = l * r;
+      return true;
+    case ND_DIV:
+      if (r == 0 || (node->rhs->val == -1 && node->lhs->val == LONG_MIN))
+        return false;
+      *val = node->lhs->val / node->rhs->val;
+      return true;
+    case ND_SHL:
+      *val = l << r;
+      return true;
+    case ND_EQ:
+      *val = node->lhs->val == node->rhs->val;
+      return true;
+    case ND_NE:
+      *val = node->lhs->val != node->rhs->val;
+      return true;
+    case ND_LT:
+      *val = node->lhs->val < node->rhs->val;
+      return true;
+    case ND_LE:
+      *val = node->lhs->val <= node->rhs->val;
+      return true;
+  }
+  return false;
+}
+
+static void simplify(Node *node) {
+  Node *lhs = node->lhs;
+  Node *rhs = node->rhs;
+
+  switch (node->kind) {
+    case ND_ADDR:
+      // &*p -> p。pが配列のときに置き換えると、
+      // 配列のアドレスの代わりに中身を読んでしまう
+      if (lhs->kind == ND_DEREF && lhs->lhs->ty->kind != TY_ARRAY) {
+        Type *ty = node->ty;
+        replace(node, lhs->lhs);
+        node->ty = ty;
+      }
+      return;
+    case ND_NEG:
+      if (lhs->kind == ND_NUM) to_num(node, -(unsigned long)lhs->val);
+      return;
+    case ND_ADD:
+      if (is_num(rhs, 0)) {  // x+0 -> x
+        replace(node, lhs);
+        return;
+      }
+      if (is_num(lhs, 0)) {  // 0+x -> x
+        replace(node, rhs);
+        return;
+      }
+      return;
+    case ND_SUB:
+      if (is_num(rhs, 0)) {  // x-0 -> x
+        replace(node, lhs);
+        return;
+      }
+      if (is_num(lhs, 0)) {  // 0-x -> -x
+        node->kind = ND_NEG;
+        node->lhs = rhs;
+        node->rhs = NULL;
+      }
+      return;
+    case ND_MUL: {
+      // 定数を右辺に寄せる
+      if (lhs->kind == ND_NUM) {
+        node->lhs = rhs;
+        node->rhs = lhs;
+        lhs = node->lhs;
+        rhs = node->rhs;
+      }
+      if (rhs->kind != ND_NUM) return;
+
+      if (rhs->val == 1) {  // x*1 -> x
+        replace(node, lhs);
+        return;
+      }
+      if (rhs->val == 0 && is_pure(lhs)) {
+        to_num(node, 0);
+        return;
+      }
+
+      int shift = log2_of(rhs->val);  // x*2^k -> x<<k
+      if (shift > 0) {
+        node->kind = ND_SHL;
+        rhs->val = shift;
+      }
+      return;
+    }
+    case ND_DIV:
+      if (is_num(rhs, 1)) {  // x/1 -> x
+        replace(node, lhs);
+        return;
+      }
+      return;
+    case ND_PTR_SUB:
+      // p-c -> p+(-c)
+      if (rhs->kind == ND_NUM) {
+        node->kind = ND_PTR_ADD;
+        rhs->val = -(unsigned long)rhs->val;
+        simplify(node);
+      }
+      return;
+    case ND_PTR_ADD:
+      if (rhs->kind != ND_NUM) return;
+      if (rhs->val == 0) {
+        replace(node, lhs);
+        return;
+      }
+
+      // (p+c1)+c2 -> p+(c1+c2)
+      if (lhs->kind == ND_PTR_ADD && lhs->rhs->kind == ND_NUM &&
+          lhs->ty->base->size == node->ty->base->size) {
+        rhs->val += lhs->rhs->val;
+        node->lhs = lhs->lhs;
+        simplify(node);
+      }
+      return;
+  }
+}
+
+static void fold_list(Node *node) {
+  for (Node *n = node; n; n = n->next) fold(n);
+}
+
+static void fold(Node *node) {
+  Node **slots[MAX_NODE_SLOTS];
+  int nslots = node_slots(node, slots);
+  for (int i = 0; i < nslots; i++) fold_list(*slots[i]);
+
+  // 畳み込むのは二項演算と&、単項の-だけ。ほかのノードではlhsとrhsの場所に
+  // 別のフィールドが入っている
+  bool binary = nslots == 2;
+  long val;
+  if (binary && node->lhs->kind == ND_NUM && node->rhs->kind == ND_NUM &&
+      eval(node, &val)) {
+    to_num(node, val);
+    return;
+  }
+
+  if (binary || node->kind == ND_ADDR || node->kind == ND_NEG) simplify(node);
+}
+
+//
+// 到達しない文の削除
+//
+
+static void prune(Node *node);
+
+// 文の後ろに制御が移りうるか
+static bool falls_through(Node *node) {
+  switch (node->kind) {
+    case ND_RETURN:
+      return false;
+    case ND_IF:
+      return !node->els || falls_through(node->then) ||
+             falls_through(node->els);
+    case ND_WHILE:
+    case ND_FOR:
+      return node->cond;
+    case ND_BLOCK: {
+      // pruneの後なので、後ろに制御が移らない文があれば最後の文になっている
+      Node *last = node->body;
+      if (!last) return true;
+      while (last->next) last = last->next;
+      return falls_through(last);
+    }
+  }
+  return true;
+}
+
+// 文のリストを刈り込み、後ろに制御が移らない文より後ろを捨てる
+static void prune_list(Node *node) {
+  for (Node *n = node; n; n = n->next) {
+    prune(n);
+    if (falls_through(n)) continue;
+    for (Node *dead = n->next; dead; dead = dead->next) tu->stats.dead_stmts++;
+    n->next = NULL;
+    return;
+  }
+}
+
+static void to_null(Node *node) {
+  node->kind = ND_NULL;
+  node->ty = NULL;
+}
+
+static void prune(Node *node) {
+  switch (node->kind) {
+    case ND_IF: {
+      if (node->cond->kind != ND_NUM) {
+        prune(node->then);
+        if (node->els) prune(node->els);
+        return;
+      }
+
+      Node *taken = node->cond->val ? node->then : node->els;
+      tu->stats.dead_stmts += node->cond->val ? !!node->els : 1;
+      if (taken)
+        replace(node, taken);
+      else
+        to_null(node);
+      prune(node);
+      return;
+    }
+    case ND_WHILE:
+    case ND_FOR:
+      if (node->cond && node->cond->kind == ND_NUM) {
+        if (!node->cond->val) {
+          // 本体は一度も実行されない。初期化の式だけを残す
+          tu->stats.dead_stmts++;
+          if (node->kind == ND_FOR && node->init)
+            replace(node, node->init);
+          else
+            to_null(node);
+          return;
+        }
+        node->cond = NULL;
+      }
+      prune(node->then);
+      return;
+    case ND_BLOCK:
+      prune_list(node->body);
+      return;
+  }
+
+  // ステートメント式の中の文は、最後の式の値を使うので切り詰めずに刈り込む
+  Node **slots[MAX_NODE_SLOTS];
+  int nslots = node_slots(node, slots);
+  for (int i = 0; i < nslots; i++)
+    for (Node *n = *slots[i]; n; n = n->next) prune(n);
+}
+
+//
+// 参照されない変数の削除
+//
+
+static void mark_refs(Node *node) {
+  for (; node; node = node->next) {
+    if (node->kind == ND_VAR) node->var->referenced = true;
+    Node **slots[MAX_NODE_SLOTS];
+    int nslots = node_slots(node, slots);
+    for (int i = 0; i < nslots; i++) mark_refs(*slots[i]);
+  }
+}
+
+// リストから参照されない変数を外す。外した数を返す
+static int drop_unreferenced(VarList **list) {
+  int n = 0;
+  while (*list) {
+    if ((*list)->var->referenced) {
+      list = &(*list)->next;
+      continue;
+    }
+    *list = (*list)->next;
+    n++;
+  }
+  return n;
+}
+
+static void drop_block_vars(BlockScope *bs) {
+  tu->stats.dead_vars += drop_unreferenced(&bs->vars);
+  for (BlockScope *child = bs->children; child; child = child->next)
+    drop_block_vars(child);
+}
+
+void optimize(Program *prog) {
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    fold_list(fn->node);
+    prune_list(fn->node);
+    mark_refs(fn->node);
+
+    // 仮引数はプロローグがフレームに保存するので、参照されなくても残す
+    for (VarList *vl = fn->params; vl; vl = vl->next)
+      vl->var->referenced = true;
+  }
+
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    drop_unreferenced(&fn->locals);
+    drop_block_vars(fn->scope);
+  }
+
+  // 文字列リテラルは翻訳単位の外からは参照されない
+  VarList **list = &prog->globals;
+  while (*list) {
+    Var *var = (*list)->var;
+    if (var->contents && !var->referenced) {
+      *list = (*list)->next;
+      tu->stats.dead_vars++;
+    } else {
+      list = &(*list)->next;
+    }
+  }
+}
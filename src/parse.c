@@ -6,36 +6,171 @@
 // gen関数で演算子のアセンブリを生成しているため、ここでは構文木のみを作成
 //
 
-// 解析中に作成されたすべてのローカル変数インスタンスは
-// この配列に蓄積されます。
-static VarList *locals;
-static VarList *globals;
-static VarList *scope;
+// 解析中の状態(locals, globals, blockとスコープの表)はすべて翻訳単位(tu)が持つ
+
+// ブロックスコープで見える変数の宣言
+typedef struct VarScope VarScope;
+struct VarScope {
+  VarScope *next;    // 直前に宣言された変数。スコープを抜けるときはこの順に戻す
+  VarScope *shadow;  // 同じ名前で外側のスコープにある宣言
+  Symbol *sym;
+  Var *var;
+};
+
+// 名前(Symbol)から最も内側の宣言を引くハッシュ表
+typedef struct ScopeSlot ScopeSlot;
+struct ScopeSlot {
+  Symbol *sym;
+  VarScope *vs;
+};
+
+static ScopeSlot *find_slot(ScopeSlot *tab, int cap, Symbol *sym) {
+  int i = sym->hash & (cap - 1);
+  while (tab[i].sym && tab[i].sym != sym) i = (i + 1) & (cap - 1);
+  return &tab[i];
+}
+
+// symに対応するスロットを返す。なければ作成する
+static ScopeSlot *scope_slot(Symbol *sym) {
+  if (tu->scope_used * 2 >= tu->scope_cap) {
+    int cap = tu->scope_cap ? tu->scope_cap * 2 : 256;
+    ScopeSlot *tab = calloc(cap, sizeof(ScopeSlot));
+    for (int i = 0; i < tu->scope_cap; i++)
+      if (tu->scope_tab[i].sym)
+        *find_slot(tab, cap, tu->scope_tab[i].sym) = tu->scope_tab[i];
+    free(tu->scope_tab);
+    tu->scope_tab = tab;
+    tu->scope_cap = cap;
+  }
+
+  ScopeSlot *slot = find_slot(tu->scope_tab, tu->scope_cap, sym);
+  if (!slot->sym) {
+    slot->sym = sym;
+    tu->scope_used++;
+  }
+  return slot;
+}
+
+static void push_scope(Symbol *sym, Var *var) {
+  ScopeSlot *slot = scope_slot(sym);
+  VarScope *vs = arena_alloc(&tu->ast_arena, sizeof(VarScope));
+  vs->sym = sym;
+  vs->var = var;
+  vs->shadow = slot->vs;
+  vs->next = tu->scope;
+  slot->vs = vs;
+  tu->scope = vs;
+}
+
+// scが指す時点より後に宣言された変数を見えなくする
+static void leave_scope(VarScope *sc) {
+  for (; tu->scope != sc; tu->scope = tu->scope->next)
+    scope_slot(tu->scope->sym)->vs = tu->scope->shadow;
+}
+
+// 内側のブロックに入る。宣言した変数はこのブロックに登録される
+static BlockScope *enter_block(void) {
+  BlockScope *bs = arena_alloc(&tu->ast_arena, sizeof(BlockScope));
+  bs->parent = tu->block;
+  if (tu->block) {
+    bs->next = tu->block->children;
+    tu->block->children = bs;
+  }
+  tu->block = bs;
+  return bs;
+}
+
+static void leave_block(void) { tu->block = tu->block->parent; }
 
-// Find a local variable by name.
+// Find a variable by name.
 static Var *find_var(Token *tok) {
-  for (VarList *vl = scope; vl; vl = vl->next) {
-    Var *var = vl->var;
-    if (strlen(var->name) == tok->len &&
-        !strncmp(tok->str, var->name, tok->len))
-      return var;
+  tu->stats.var_lookups++;
+  if (!tu->scope_cap) return NULL;
+
+  Symbol *sym = token_sym(tok);
+  ScopeSlot *slot = find_slot(tu->scope_tab, tu->scope_cap, sym);
+
+  int home = sym->hash & (tu->scope_cap - 1);
+  long probes = ((slot - tu->scope_tab - home) & (tu->scope_cap - 1)) + 1;
+  tu->stats.var_probes += probes;
+  if (tu->stats.max_var_probe < probes) tu->stats.max_var_probe = probes;
+  return slot->vs ? slot->vs->var : NULL;
+}
+
+// 種類ごとのノードの大きさ。共通の部分に、使うフィールドの分だけを足す
+size_t node_size(NodeKind kind) {
+  switch (kind) {
+    case ND_VAR:
+    case ND_NUM:
+    case ND_NULL:
+      return offsetof(Node, lhs) + sizeof(void *);
+    case ND_IF:
+    case ND_WHILE:
+    case ND_FOR:
+      return sizeof(Node);
   }
-  return NULL;
+  return offsetof(Node, lhs) + sizeof(void *) * 2;
+}
+
+// ノードの子を指すフィールドのアドレスをslotsに入れ、その数を返す。
+// bodyとargsは`next`でつながったリストの先頭で、それ以外の子は1つのノード
+// (nextはNULL)。NULLの子も含めて返す
+int node_slots(Node *node, Node ***slots) {
+  int n = 0;
+  switch (node->kind) {
+    case ND_VAR:
+    case ND_NUM:
+    case ND_NULL:
+      break;
+    case ND_ADDR:
+    case ND_DEREF:
+    case ND_NEG:
+    case ND_MEMBER:
+    case ND_RETURN:
+    case ND_EXPR_STMT:
+      slots[n++] = &node->lhs;
+      break;
+    case ND_IF:
+      slots[n++] = &node->cond;
+      slots[n++] = &node->then;
+      slots[n++] = &node->els;
+      break;
+    case ND_WHILE:
+    case ND_FOR:
+      slots[n++] = &node->cond;
+      slots[n++] = &node->then;
+      slots[n++] = &node->init;
+      slots[n++] = &node->inc;
+      break;
+    case ND_BLOCK:
+    case ND_STMT_EXPR:
+      slots[n++] = &node->body;
+      break;
+    case ND_FUNCALL:
+      slots[n++] = &node->args;
+      break;
+    default:
+      slots[n++] = &node->lhs;
+      slots[n++] = &node->rhs;
+  }
+  return n;
 }
 
 /* ノードの作成関数 */
 static Node *new_node(NodeKind kind, Token *tok) {
-  Node *node = calloc(1, sizeof(Node));
+  Node *node = arena_alloc(&tu->ast_arena, node_size(kind));
+  tu->stats.nodes[kind]++;
   node->kind = kind;
   node->tok = tok;
   return node;
 }
 
-/* 二分木ノードの作成関数 */
+/* 二分木ノードの作成関数。型は子の型から決まる */
 static Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok) {
   Node *node = new_node(kind, tok);
   node->lhs = lhs;
   node->rhs = rhs;
+  add_type(node);
   return node;
 }
 
@@ -43,6 +178,7 @@ static Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok) {
 static Node *new_unary(NodeKind kind, Node *expr, Token *tok) {
   Node *node = new_node(kind, tok);
   node->lhs = expr;
+  add_type(node);
   return node;
 }
 
@@ -50,6 +186,7 @@ static Node *new_unary(NodeKind kind, Node *expr, Token *tok) {
 static Node *new_num(long val, Token *tok) {
   Node *node = new_node(ND_NUM, tok);
   node->val = val;
+  add_type(node);
   return node;
 }
 
@@ -57,52 +194,50 @@ static Node *new_num(long val, Token *tok) {
 static Node *new_var_node(Var *var, Token *tok) {
   Node *node = new_node(ND_VAR, tok);
   node->var = var;
+  add_type(node);
   return node;
 }
 
 /* 変数のノード作成関数 */
 static Var *new_var(char *name, Type *ty, bool is_local) {
-  Var *var = calloc(1, sizeof(Var));  // Varの構造体一つずつに1byteメモリを確保
+  Var *var = arena_alloc(&tu->ast_arena, sizeof(Var));
   var->name = name;
   var->ty = ty;
   var->is_local = is_local;
-
-  VarList *sc = calloc(1, sizeof(VarList));
-  sc->var = var;
-  sc->next = scope;
-  scope = sc;
   return var;
 }
 
-/* ローカル変数専用のノード作成関数 */
-static Var *new_lvar(char *name, Type *ty) {
-  Var *var = new_var(name, ty, true);
+/* ローカル変数専用のノード作成関数。現在のスコープに名前を登録する */
+static Var *new_lvar(Symbol *sym, Type *ty) {
+  Var *var = new_var(sym->name, ty, true);
+  push_scope(sym, var);
 
-  var->name = name;
-  var->ty = ty;
+  VarList *vl = arena_alloc(&tu->ast_arena, sizeof(VarList));
+  vl->var = var;
+  vl->next = tu->locals;
+  tu->locals = vl;
 
-  VarList *vl = calloc(1, sizeof(VarList));
+  vl = arena_alloc(&tu->ast_arena, sizeof(VarList));
   vl->var = var;
-  vl->next = locals;
-  locals = vl;
+  vl->next = tu->block->vars;
+  tu->block->vars = vl;
   return var;
 }
 
 static Var *new_gvar(char *name, Type *ty) {
   Var *var = new_var(name, ty, false);
 
-  VarList *vl = calloc(1, sizeof(VarList));
+  VarList *vl = arena_alloc(&tu->ast_arena, sizeof(VarList));
   vl->var = var;
-  vl->next = globals;
-  globals = vl;
+  vl->next = tu->globals;
+  tu->globals = vl;
   return var;
 }
 
 static char *new_label(void) {
-  static int cnt = 0;
   char buf[20];
-  sprintf(buf, ".L.data.%d", cnt++);
-  return strndup(buf, 20);
+  sprintf(buf, ".L.data.%d", tu->label_seq++);
+  return arena_strndup(&tu->ast_arena, buf, strlen(buf));
 }
 
 // forward declaration
@@ -115,7 +250,6 @@ static void global_var(void);
 static Node *declaration(void);
 static bool is_typename(void);
 static Node *stmt(void);
-static Node *stmt2(void);
 static Node *expr(void);
 static Node *assign(void);
 static Node *equality(void);
@@ -130,13 +264,134 @@ static Node *primary(void);
   次のトップレベルの項目が関数かグローバル変数かを、入力トークンを先読みして判断します。
  */
 static bool is_function(void) {
-  Token *tok = token;
+  int pos = tu->tok_pos;
   basetype();
   bool isfunc = consume_ident() && consume("(");
-  token = tok;
+  tu->tok_pos = pos;
   return isfunc;
 }
 
+//
+// --keep-goingのエラーからの回復。
+// 文やトップレベルの項目の解析中にエラーが起きたら、その終わりまでトークンを
+// 読み飛ばして次から解析を続ける。括弧の深さを数えて終わりを見つける
+//
+
+// 文の終わりまで読み飛ばす。深さ0の";"の次か、深さが0に戻る"}"の次、
+// 外側のブロックを閉じる"}"の手前で止まる。入力の終わりに来たらfalseを返す
+static bool skip_stmt(void) {
+  int depth = 0;
+  for (; !at_eof(); tu->tok_pos++) {
+    if (peek("{")) {
+      depth++;
+    } else if (peek("}")) {
+      if (depth == 0) return true;
+      if (--depth == 0) {
+        tu->tok_pos++;
+        return true;
+      }
+    } else if (depth == 0 && peek(";")) {
+      tu->tok_pos++;
+      return true;
+    }
+  }
+  return false;
+}
+
+// ブロックの中の文を1つ解析する。エラーが起きたら文を読み飛ばして空文を返す
+static Node *block_item(void) {
+  if (!opt_keep_going) return stmt();
+
+  jmp_buf jb;
+  jmp_buf *outer = tu->recover;
+  VarScope *sc = tu->scope;
+  BlockScope *block = tu->block;
+  Token *tok = current_token();
+
+  if (setjmp(jb)) {
+    tu->recover = outer;
+    leave_scope(sc);
+    tu->block = block;
+    if (!skip_stmt()) longjmp(*outer, 1);  // 外側でも入力の終わりまで来ている
+    return new_node(ND_NULL, tok);
+  }
+
+  tu->recover = &jb;
+  Node *node = stmt();
+  tu->recover = outer;
+  return node;
+}
+
+// トップレベルの項目を読み飛ばす。括弧の深さは項目の先頭posから数え、
+// エラーの位置より後ろの、深さ0の";"の次か、深さが0に戻って次に
+// 型名が続く"}"の次で止まる
+static void skip_top_level(int pos) {
+  int err = tu->tok_pos;
+  int depth = 0;
+  for (tu->tok_pos = pos; !at_eof(); tu->tok_pos++) {
+    if (peek("{")) {
+      depth++;
+    } else if (peek("}") && depth > 0) {
+      if (--depth == 0 && tu->tok_pos >= err) {
+        tu->tok_pos++;
+        if (at_eof() || is_typename()) return;
+        tu->tok_pos--;
+      }
+    } else if (depth == 0 && tu->tok_pos >= err && peek(";")) {
+      tu->tok_pos++;
+      return;
+    }
+  }
+}
+
+// トップレベルの項目を1つ解析し、関数ならそれを返す
+static Function *top_level(void) {
+  if (is_function()) return function();
+  global_var();
+  return NULL;
+}
+
+// エラーが起きたら項目を読み飛ばしてNULLを返す
+static Function *top_level_item(void) {
+  if (!opt_keep_going) return top_level();
+
+  jmp_buf jb;
+  VarScope *sc = tu->scope;
+  int pos = tu->tok_pos;
+
+  if (setjmp(jb)) {
+    tu->recover = NULL;
+    leave_scope(sc);
+    tu->block = NULL;
+    skip_top_level(pos);
+    return NULL;
+  }
+
+  tu->recover = &jb;
+  Function *fn = top_level();
+  tu->recover = NULL;
+  return fn;
+}
+
+// --stream-tokens: 構文木が指すトークンをアリーナに写し、トークン列から
+// 捨てられるようにする。同じトークンを指すノードは1つの写しを共有する
+static void keep_tokens(Node *node, Token **copies) {
+  for (; node; node = node->next) {
+    int i = node->tok ? token_index(node->tok) : -1;
+    if (i >= 0) {
+      if (!copies[i]) {
+        copies[i] = arena_alloc(&tu->ast_arena, sizeof(Token));
+        *copies[i] = *node->tok;
+      }
+      node->tok = copies[i];
+    }
+
+    Node **slots[MAX_NODE_SLOTS];
+    int nslots = node_slots(node, slots);
+    for (int i = 0; i < nslots; i++) keep_tokens(*slots[i], copies);
+  }
+}
+
 /*
   複数行プログラム全体をパースする関数
   EBNF: program = (global-var | function)*
@@ -144,26 +399,32 @@ static bool is_function(void) {
 Program *program(void) {
   Function head = {};
   Function *cur = &head;
-  globals = NULL;
+  tu->globals = NULL;
 
   while (!at_eof()) {
-    if (is_function()) {
-      cur->next = function();
-      cur = cur->next;
-    } else {
-      global_var();
+    Function *fn = top_level_item();
+    if (fn) cur = cur->next = fn;
+
+    // 次の項目を解析している間は、その先頭より前のトークンに戻らない
+    if (opt_stream_tokens) {
+      if (fn) {
+        Token **copies = calloc(tu->ntokens - tu->tok_base, sizeof(Token *));
+        keep_tokens(fn->node, copies);
+        free(copies);
+      }
+      release_tokens();
     }
   }
 
-  Program *prog = calloc(1, sizeof(Program));
-  prog->globals = globals;
+  Program *prog = arena_alloc(&tu->ast_arena, sizeof(Program));
+  prog->globals = tu->globals;
   prog->fns = head.next;
   return prog;
 }
 
 // basetype = ("char" | "int" | struct-decl) "*"*
 static Type *basetype(void) {
-  if (!is_typename()) error_tok(token, "typename expected");
+  if (!is_typename()) error_tok(current_token(), "typename expected");
 
   Type *ty;
   if (consume("char"))
@@ -200,26 +461,28 @@ static Type *struct_decl(void) {
     cur = cur->next;
   }
 
-  Type *ty = calloc(1, sizeof(Type));
-  ty->kind = TY_STRUCT;
+  Type *ty = new_type(TY_STRUCT, 0, 1);
   ty->members = head.next;
 
   // Assign offsets within the struct to members.
+  // 各メンバはその型のアラインメントに揃え、構造体全体は最大のものに揃える
   int offset = 0;
   for (Member *mem = ty->members; mem; mem = mem->next) {
+    offset = align_to(offset, mem->ty->align);
     mem->offset = offset;
     offset += mem->ty->size;
+    if (ty->align < mem->ty->align) ty->align = mem->ty->align;
   }
-  ty->size = offset;
+  ty->size = align_to(offset, ty->align);
 
   return ty;
 }
 
 // struct-member = basetype ident ("[" num "]")* ";"
 static Member *struct_member(void) {
-  Member *mem = calloc(1, sizeof(Member));
+  Member *mem = arena_alloc(&tu->ast_arena, sizeof(Member));
   mem->ty = basetype();
-  mem->name = expect_ident();
+  mem->name = expect_ident()->name;
   mem->ty = read_type_suffix(mem->ty);
   expect(";");
   return mem;
@@ -227,10 +490,10 @@ static Member *struct_member(void) {
 
 static VarList *read_func_param(void) {
   Type *ty = basetype();
-  char *name = expect_ident();
+  Symbol *name = expect_ident();
   ty = read_type_suffix(ty);
 
-  VarList *vl = calloc(1, sizeof(VarList));
+  VarList *vl = arena_alloc(&tu->ast_arena, sizeof(VarList));
   vl->var = new_lvar(name, ty);
   return vl;
 }
@@ -256,14 +519,16 @@ static VarList *read_func_params(void) {
 // params   = param ("," param)*
 // param    = basetype ident
 static Function *function(void) {
-  locals = NULL;
+  tu->locals = NULL;
 
-  Function *fn = calloc(1, sizeof(Function));
+  Function *fn = arena_alloc(&tu->ast_arena, sizeof(Function));
+  fn->tok_begin = tu->tok_pos;
   basetype();
-  fn->name = expect_ident();
+  fn->name = expect_ident()->name;
   expect("(");
 
-  VarList *sc = scope;
+  VarScope *sc = tu->scope;
+  fn->scope = enter_block();
   fn->params = read_func_params();
   expect("{");
 
@@ -271,31 +536,34 @@ static Function *function(void) {
   Node *cur = &head;
 
   while (!consume("}")) {
-    cur->next = stmt();
+    cur->next = block_item();
     cur = cur->next;
   }
-  scope = sc;
+  leave_scope(sc);
+  leave_block();
 
+  fn->tok_end = tu->tok_pos;
+  if (cache_enabled()) fn->hash = hash_tokens(fn->tok_begin, fn->tok_end);
   fn->node = head.next;
-  fn->locals = locals;
+  fn->locals = tu->locals;
   return fn;
 }
 
 // global-var = basetype ident ("[" num "]")* ";"
 static void global_var(void) {
   Type *ty = basetype();
-  char *name = expect_ident();
+  Symbol *name = expect_ident();
   ty = read_type_suffix(ty);
   expect(";");
-  new_gvar(name, ty);
+  push_scope(name, new_gvar(name->name, ty));
 }
 
 // 変数宣言
 // declaration = basetype ident ("[" num "]")* ("=" expr) ";"
 static Node *declaration(void) {
-  Token *tok = token;
+  Token *tok = current_token();
   Type *ty = basetype();
-  char *name = expect_ident();
+  Symbol *name = expect_ident();
   ty = read_type_suffix(ty);
   Var *var = new_lvar(name, ty);
 
@@ -310,7 +578,7 @@ static Node *declaration(void) {
 }
 
 static Node *read_expr_stmt(void) {
-  Token *tok = token;
+  Token *tok = current_token();
   return new_unary(ND_EXPR_STMT, expr(), tok);
 }
 
@@ -319,13 +587,6 @@ static bool is_typename(void) {
   return peek("char") || peek("int") || peek("struct");
 }
 
-/* 渡されたノードに型ノードを追加する処理を挟む */
-static Node *stmt(void) {
-  Node *node = stmt2();
-  add_type(node);
-  return node;
-}
-
 /*
   予約語と、行の区切り文字`;`をパースする関数
   EBNF: stmt = "return" expr ";"
@@ -336,7 +597,7 @@ static Node *stmt(void) {
               | declaration
               | expr ";"
  */
-static Node *stmt2(void) {
+static Node *stmt(void) {
   Token *tok;
   if (tok = consume("return")) {
     Node *node = new_unary(ND_RETURN, expr(), tok);
@@ -385,19 +646,22 @@ static Node *stmt2(void) {
     return node;
   }
 
-  VarList *sc = scope;
+  VarScope *sc = tu->scope;
   if (tok = consume("{")) {
     Node head = {};
     Node *cur = &head;
+    BlockScope *bs = enter_block();
 
     while (!consume("}")) {
-      cur->next = stmt();
+      cur->next = block_item();
       cur = cur->next;
     }
-    scope = sc;
+    leave_scope(sc);
+    leave_block();
 
     Node *node = new_node(ND_BLOCK, tok);
     node->body = head.next;
+    node->scope = bs;
     return node;
   }
 
@@ -467,9 +731,6 @@ static Node *relational(void) {
 
 /* 整数同士の足し算、ポインタの足し算ノードを作成する関数 */
 static Node *new_add(Node *lhs, Node *rhs, Token *tok) {
-  add_type(lhs);
-  add_type(rhs);
-
   if (is_integer(lhs->ty) && is_integer(rhs->ty))
     return new_binary(ND_ADD, lhs, rhs, tok);
   if (lhs->ty->base && is_integer(rhs->ty))
@@ -481,9 +742,6 @@ static Node *new_add(Node *lhs, Node *rhs, Token *tok) {
 
 /* 整数同士の引き算、ポインタの引き算ノードを作成する関数 */
 static Node *new_sub(Node *lhs, Node *rhs, Token *tok) {
-  add_type(lhs);
-  add_type(rhs);
-
   if (is_integer(lhs->ty) && is_integer(rhs->ty))
     return new_binary(ND_SUB, lhs, rhs, tok);
   if (lhs->ty->base && is_integer(rhs->ty))
@@ -541,30 +799,35 @@ static Node *unary(void) {
   if (tok = consume("-"))  // -xを0 - xに置換
     return new_binary(ND_SUB, new_num(0, tok), unary(), tok);
 
-  if (tok = consume("&"))  // -アドレスを取り出す
-    return new_unary(ND_ADDR, unary(), tok);
+  if (tok = consume("&")) {  // -アドレスを取り出す
+    Node *node = new_unary(ND_ADDR, unary(), tok);
+    if (node->lhs->kind == ND_VAR) node->lhs->var->addr_taken = true;
+    return node;
+  }
 
   if (tok = consume("*"))  // ポインタまたはアドレスから値を取り出す
     return new_unary(ND_DEREF, unary(), tok);
   return postfix();
 }
 
+// メンバ名は登録済みの文字列なので、ポインタの比較だけでよい
 static Member *find_member(Type *ty, char *name) {
   for (Member *mem = ty->members; mem; mem = mem->next)
-    if (!strcmp(mem->name, name)) return mem;
+    if (mem->name == name) return mem;
   return NULL;
 }
 
 static Node *struct_ref(Node *lhs) {
-  add_type(lhs);
   if (lhs->ty->kind != TY_STRUCT) error_tok(lhs->tok, "not a struct");
 
-  Token *tok = token;
-  Member *mem = find_member(lhs->ty, expect_ident());
+  Token *tok = current_token();
+  Member *mem = find_member(lhs->ty, expect_ident()->name);
   if (!mem) error_tok(tok, "no such member");
 
-  Node *node = new_unary(ND_MEMBER, lhs, tok);
+  Node *node = new_node(ND_MEMBER, tok);
+  node->lhs = lhs;
   node->member = mem;
+  add_type(node);
   return node;
 }
 
@@ -595,19 +858,24 @@ static Node *postfix(void) {
 //
 // ステートメント式は、GNU Cの拡張機能です。
 static Node *stmt_expr(Token *tok) {
+  VarScope *sc = tu->scope;
   Node *node = new_node(ND_STMT_EXPR, tok);
+  node->scope = enter_block();
   node->body = stmt();
   Node *cur = node->body;
 
   while (!consume("}")) {
-    cur->next = stmt();
+    cur->next = block_item();
     cur = cur->next;
   }
   expect(")");
+  leave_scope(sc);
+  leave_block();
 
   if (cur->kind != ND_EXPR_STMT)
     error_tok(cur->tok, "stmt expr returning void is not supported");
-  memcpy(cur, cur->lhs, sizeof(Node));
+  memcpy(cur, cur->lhs, node_size(cur->lhs->kind));
+  add_type(node);
   return node;
 }
 
@@ -651,7 +919,6 @@ static Node *primary(void) {
 
   if (tok = consume("sizeof")) {
     Node *node = unary();
-    add_type(node);
     return new_num(node->ty->size, tok);
   }
 
@@ -659,9 +926,9 @@ static Node *primary(void) {
     // 識別子の次に"()"がきたら Function
     if (consume("(")) {
       Node *node = new_node(ND_FUNCALL, tok);
-      // strndupは第2引数のサイズ指定分、文字列を複製する
-      node->funcname = strndup(tok->str, tok->len);
+      node->funcname = token_sym(tok)->name;
       node->args = func_args();  // 引数ノードの作成は`func_args`に任せる
+      add_type(node);
       return node;
     }
 
@@ -672,14 +939,14 @@ static Node *primary(void) {
     return new_var_node(var, tok);
   }
 
-  tok = token;
+  tok = current_token();
   if (tok->kind == TK_STR) {
-    token = token->next;
+    tu->tok_pos++;
 
-    Type *ty = array_of(char_type, tok->cont_len);
+    Type *ty = array_of(char_type, token_cont_len(tok));
     Var *var = new_gvar(new_label(), ty);
-    var->contents = tok->contents;
-    var->cont_len = tok->cont_len;
+    var->contents = token_contents(tok);
+    var->cont_len = token_cont_len(tok);
     return new_var_node(var, tok);
   }
 
@@ -0,0 +1,489 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// 出力したアセンブリに対する覗き穴(peephole)最適化。
+// 関数1つ分のバッファを命令の列として読み、近くにある数命令の組を
+// より少ない命令に置き換える。スタックマシンが出すpush/popの組はレジスタ間のmovに、
+// 即値を入れるだけのレジスタは即値オペランドに、leaで求めたアドレスの間接参照は
+// [rbp-N]の直接参照になる。
+// レジスタやフラグがその後に使われないことは、先の命令を数個だけ調べて確かめる。
+// ラベル、ジャンプ、call、retを越えてはパターンを探さない。
+//
+
+#define WINDOW 16  // レジスタやフラグが使われないことを調べる命令の数
+
+#define RSP 4
+#define BIT(r) (1u << (r))
+
+// 関数呼び出しで壊れるレジスタ(rax, rcx, rdx, rsi, rdi, r8-r11)と、
+// そのうち引数を渡すのに使うもの(raxは可変長引数の個数)
+#define CALLER_SAVED 0x0fc7u
+#define ARG_REGS 0x03c7u
+
+typedef enum { OPD_REG, OPD_MEM, OPD_IMM, OPD_OTHER } OpdKind;
+
+typedef struct {
+  char *s;  // オペランドの表記
+  int len;
+  OpdKind kind;
+  int reg;        // OPD_REG
+  int size;       // OPD_REG
+  unsigned addr;  // OPD_MEM: アドレスの計算に使うレジスタの集合
+  long imm;       // OPD_IMM
+} Opd;
+
+typedef struct {
+  char *s;  // 行の内容。命令ならインデントを除く
+  int len;
+  bool insn;      // 書き換えの対象にする命令の行か。ラベルならfalse
+  bool indented;  // インデントされた行(命令)か
+  bool deleted;
+  char *mn;  // ニーモニック
+  int mnlen;
+  Opd op[2];
+  int nops;
+  char *own;  // 書き換えた行の内容
+} Line;
+
+// -jで複数のスレッドから呼ばれるので、作業用の領域はスレッドごとに持つ
+static _Thread_local Line *lines;
+static _Thread_local int nlines;
+
+static bool is(Line *l, char *mn) {
+  return strlen(mn) == l->mnlen && !strncmp(l->mn, mn, l->mnlen);
+}
+
+static bool same(Opd *a, Opd *b) {
+  return a->len == b->len && !strncmp(a->s, b->s, a->len);
+}
+
+static bool is_reg64(Opd *op) { return op->kind == OPD_REG && op->size == 8; }
+
+static bool is_reg(Opd *op, int reg) {
+  return op->kind == OPD_REG && op->reg == reg;
+}
+
+static void parse_opd(Opd *op, char *s, int len) {
+  *op = (Opd){s, len, OPD_OTHER};
+
+  if (parse_reg(s, len, &op->reg, &op->size)) {
+    op->kind = OPD_REG;
+    return;
+  }
+
+  char *p = memchr(s, '[', len);
+  if (p) {
+    op->kind = OPD_MEM;
+    for (char *end = s + len; p < end;) {
+      if (!isalnum(*p)) {
+        p++;
+        continue;
+      }
+      char *q = p;
+      while (q < end && isalnum(*q)) q++;
+      int reg, size;
+      if (parse_reg(p, q - p, &reg, &size)) op->addr |= BIT(reg);
+      p = q;
+    }
+    return;
+  }
+
+  char *end;
+  long val = strtol(s, &end, 10);
+  if (len && end == s + len) {
+    op->kind = OPD_IMM;
+    op->imm = val;
+  }
+}
+
+static void parse_line(Line *l) {
+  char *p = l->s;
+  char *end = l->s + l->len;
+  l->mn = p;
+  while (p < end && *p != ' ') p++;
+  l->mnlen = p - l->mn;
+
+  l->nops = 0;
+  while (p < end && l->nops < 2) {
+    while (p < end && *p == ' ') p++;
+    if (p == end) break;
+    char *q = memchr(p, ',', end - p);
+    if (!q) q = end;
+    parse_opd(&l->op[l->nops++], p, q - p);
+    p = q < end ? q + 1 : end;
+  }
+
+  // オペランドが3つ以上ある命令は扱わない
+  if (p < end) l->insn = false;
+}
+
+// 行を書き換える。引数は元の行の内容を指していてもよい
+static void set_line(Line *l, char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  char *s;
+  l->len = vasprintf(&s, fmt, ap);
+  va_end(ap);
+
+  free(l->own);
+  l->own = l->s = s;
+  parse_line(l);
+}
+
+// iより後にある、削除されていない最初の行
+static int next(int i) {
+  for (i++; i < nlines; i++)
+    if (!lines[i].deleted) return i;
+  return -1;
+}
+
+//
+// 命令の効果
+//
+
+static bool writes_first(Line *l) {
+  return is(l, "mov") || is(l, "lea") || is(l, "movsx") || is(l, "movzb") ||
+         is(l, "movzx") || is(l, "pop");
+}
+
+static bool is_alu(Line *l) {
+  return is(l, "add") || is(l, "sub") || is(l, "and") || is(l, "or") ||
+         is(l, "xor") || is(l, "cmp") || is(l, "imul") || is(l, "shl") ||
+         is(l, "neg");
+}
+
+// 命令が読むレジスタ(rd)、完全に上書きするレジスタ(wr)、
+// 値が変わりうるレジスタ(mod)を求める。
+// ジャンプなど、その先を追えない命令ならfalseを返す
+static bool effects(Line *l, unsigned *rd, unsigned *wr, unsigned *mod) {
+  *rd = *wr = *mod = 0;
+  if (!l->insn) return false;
+
+  for (int i = 0; i < l->nops; i++)
+    if (l->op[i].kind == OPD_MEM) *rd |= l->op[i].addr;
+
+  if (writes_first(l)) {
+    Opd *a = &l->op[0];
+    if (a->kind == OPD_REG) {
+      *mod |= BIT(a->reg);
+      if (a->size == 8)
+        *wr |= BIT(a->reg);
+      else
+        *rd |= BIT(a->reg);  // 下位バイトだけを書き換える
+    }
+    if (l->nops == 2 && l->op[1].kind == OPD_REG) *rd |= BIT(l->op[1].reg);
+    if (is(l, "pop")) *rd |= BIT(RSP), *mod |= BIT(RSP);
+    return true;
+  }
+
+  if (is_alu(l) || is(l, "push") || !strncmp(l->mn, "set", 3)) {
+    for (int i = 0; i < l->nops; i++)
+      if (l->op[i].kind == OPD_REG) *rd |= BIT(l->op[i].reg);
+    if (l->nops && l->op[0].kind == OPD_REG && !is(l, "cmp") && !is(l, "push"))
+      *mod |= BIT(l->op[0].reg);
+    if (is(l, "push")) *rd |= BIT(RSP), *mod |= BIT(RSP);
+    return true;
+  }
+
+  if (is(l, "cqo")) {
+    *rd |= BIT(0);
+    *wr |= BIT(2);
+    *mod |= BIT(2);
+    return true;
+  }
+
+  if (is(l, "idiv")) {
+    if (l->op[0].kind == OPD_REG) *rd |= BIT(l->op[0].reg);
+    *rd |= BIT(0) | BIT(2);
+    *mod |= BIT(0) | BIT(2);
+    return true;
+  }
+
+  return false;
+}
+
+// 関数から戻る命令か。戻った先ではraxとcallee-savedなレジスタしか使われない
+static bool is_return(Line *l) {
+  if (is(l, "ret")) return true;
+  return is(l, "jmp") && l->op[0].len > 10 &&
+         !strncmp(l->op[0].s, ".L.return.", 10);
+}
+
+// 行iから先でregの値が使われないか
+static bool reg_dead(int i, int reg) {
+  for (int n = 0; i >= 0 && n < WINDOW; i = next(i), n++) {
+    Line *l = &lines[i];
+    if (l->insn && is_return(l))
+      return reg != 0 && (BIT(reg) & CALLER_SAVED);
+    if (l->insn && is(l, "call"))
+      return (BIT(reg) & CALLER_SAVED) && !(BIT(reg) & ARG_REGS);
+
+    unsigned rd, wr, mod;
+    if (!effects(l, &rd, &wr, &mod)) return false;
+    if (rd & BIT(reg)) return false;
+    if (wr & BIT(reg)) return true;
+  }
+  return false;
+}
+
+// 行iから先でフラグが使われないか
+static bool flags_dead(int i) {
+  for (int n = 0; i >= 0 && n < WINDOW; i = next(i), n++) {
+    Line *l = &lines[i];
+    if (!l->insn) return false;
+    if (l->mn[0] == 'j' || !strncmp(l->mn, "set", 3)) return false;
+    if (is_alu(l) || is(l, "idiv")) return true;
+    unsigned rd, wr, mod;
+    if (!effects(l, &rd, &wr, &mod)) return false;
+  }
+  return false;
+}
+
+//
+// 書き換えのパターン
+//
+
+// push X; pop Y -> mov Y, X
+static bool push_pop(int i, int j) {
+  Line *push = &lines[i];
+  Line *pop = &lines[j];
+  if (!is(push, "push") || !is(pop, "pop")) return false;
+
+  push->deleted = true;
+  if (same(&push->op[0], &pop->op[0]))
+    pop->deleted = true;
+  else
+    set_line(pop, "mov %.*s, %.*s", pop->op[0].len, pop->op[0].s,
+             push->op[0].len, push->op[0].s);
+  return true;
+}
+
+// push X; I; pop Y -> I; mov Y, X
+// IがYを使わず、Xとスタックを変更しない場合に限る
+static bool push_insn_pop(int i, int j) {
+  Line *push = &lines[i];
+  Line *mid = &lines[j];
+  int k = next(j);
+  if (k < 0 || !is(push, "push") || !is(&lines[k], "pop")) return false;
+  Line *pop = &lines[k];
+
+  unsigned rd, wr, mod;
+  if (!effects(mid, &rd, &wr, &mod)) return false;
+  if (((rd | mod) & BIT(RSP)) || ((rd | mod) & BIT(pop->op[0].reg)))
+    return false;
+  if (push->op[0].kind == OPD_REG && (mod & BIT(push->op[0].reg))) return false;
+  if (push->op[0].kind == OPD_MEM) return false;
+
+  return push_pop(i, k);
+}
+
+// push X; add rsp, 8 -> (なし)
+static bool push_discard(int i, int j) {
+  Line *push = &lines[i];
+  Line *add = &lines[j];
+  if (!is(push, "push") || !is(add, "add") || !is_reg(&add->op[0], RSP) ||
+      add->op[1].kind != OPD_IMM || add->op[1].imm != 8 ||
+      push->op[0].kind == OPD_MEM || !flags_dead(next(j)))
+    return false;
+
+  push->deleted = true;
+  add->deleted = true;
+  return true;
+}
+
+// lea R, [M]; ...; mov D, [R] -> ...; mov D, [M]
+// lea R, [M]; ...; mov [R], S -> ...; mov [M], S
+static bool fold_lea(int i) {
+  Line *lea = &lines[i];
+  if (!is(lea, "lea") || !is_reg64(&lea->op[0])) return false;
+  int r = lea->op[0].reg;
+  Opd *m = &lea->op[1];
+
+  // Rを使う最初の命令を探す。途中でMのアドレスが変わってはいけない
+  int k = next(i);
+  for (int n = 0; k >= 0 && n < WINDOW; k = next(k), n++) {
+    unsigned rd, wr, mod;
+    if (!effects(&lines[k], &rd, &wr, &mod)) return false;
+    if ((rd | mod) & BIT(r)) break;
+    if (mod & (m->addr | BIT(RSP))) return false;
+  }
+  if (k < 0) return false;
+
+  Line *l = &lines[k];
+  if (!(is(l, "mov") || is(l, "movsx")) || l->nops != 2) return false;
+
+  // どちらのオペランドが[R]か。"byte ptr "などの前置きはprefixバイト
+  int ref = -1;
+  int prefix = 0;
+  for (int x = 0; x < 2; x++) {
+    Opd *op = &l->op[x];
+    if (op->kind != OPD_MEM || op->addr != BIT(r)) continue;
+    char *lb = memchr(op->s, '[', op->len);
+    if (memchr(lb, '+', op->s + op->len - lb) ||
+        memchr(lb, '-', op->s + op->len - lb) ||
+        memchr(lb, '*', op->s + op->len - lb))
+      continue;
+    ref = x;
+    prefix = lb - op->s;
+  }
+  if (ref < 0) return false;
+
+  Opd *other = &l->op[1 - ref];
+  if (other->kind == OPD_REG && other->reg == r && ref == 0) return false;
+
+  // 読み込みの結果がRそのものに入るか、Rがこの先使われなければよい
+  bool dead = (ref == 1 && is_reg(other, r)) || reg_dead(next(k), r);
+  if (!dead) return false;
+
+  Opd *mem = &l->op[ref];
+  lea->deleted = true;
+  if (ref == 0)
+    set_line(l, "%.*s %.*s%.*s, %.*s", l->mnlen, l->mn, prefix, mem->s, m->len,
+             m->s, other->len, other->s);
+  else
+    set_line(l, "%.*s %.*s, %.*s%.*s", l->mnlen, l->mn, other->len, other->s,
+             prefix, mem->s, m->len, m->s);
+  return true;
+}
+
+// mov R, imm; ...; OP D, R -> ...; OP D, imm
+static bool fold_imm(int i) {
+  Line *mov = &lines[i];
+  if (!is(mov, "mov") || !is_reg64(&mov->op[0]) ||
+      mov->op[1].kind != OPD_IMM || mov->op[1].imm < INT_MIN ||
+      mov->op[1].imm > INT_MAX)
+    return false;
+  int r = mov->op[0].reg;
+
+  int k = next(i);
+  for (int n = 0; k >= 0 && n < WINDOW; k = next(k), n++) {
+    unsigned rd, wr, mod;
+    if (!effects(&lines[k], &rd, &wr, &mod)) return false;
+    if ((rd | mod) & BIT(r)) break;
+  }
+  if (k < 0) return false;
+
+  Line *l = &lines[k];
+  if (!(is(l, "mov") || is(l, "add") || is(l, "sub") || is(l, "and") ||
+        is(l, "or") || is(l, "xor") || is(l, "cmp") || is(l, "imul")) ||
+      l->nops != 2 || !is_reg64(&l->op[0]) || l->op[0].reg == r ||
+      !is_reg(&l->op[1], r))
+    return false;
+  if (!reg_dead(next(k), r)) return false;
+
+  mov->deleted = true;
+  set_line(l, "%.*s %.*s, %ld", l->mnlen, l->mn, l->op[0].len, l->op[0].s,
+           mov->op[1].imm);
+  return true;
+}
+
+// mov rax, X; OP rax, Y; mov X, rax -> OP X, Y
+// mov rax, X; mov D, rax -> mov D, X
+static bool fold_rax(int i, int j) {
+  Line *mov = &lines[i];
+  Line *l = &lines[j];
+  if (!is(mov, "mov") || !is_reg(&mov->op[0], 0) || mov->nops != 2) return false;
+  Opd *x = &mov->op[1];
+  if (x->kind == OPD_IMM || x->kind == OPD_OTHER || is_reg(x, 0) ||
+      (x->kind == OPD_MEM && (x->addr & BIT(0))))
+    return false;
+
+  if (is(l, "mov") && is_reg(&l->op[1], 0) && l->op[0].kind != OPD_MEM) {
+    if (!reg_dead(next(j), 0)) return false;
+    mov->deleted = true;
+    set_line(l, "mov %.*s, %.*s", l->op[0].len, l->op[0].s, x->len, x->s);
+    return true;
+  }
+
+  if (x->kind != OPD_REG || l->nops != 2 || !is_reg(&l->op[0], 0) ||
+      !(is(l, "add") || is(l, "sub") || is(l, "imul") || is(l, "and") ||
+        is(l, "or") || is(l, "xor") || is(l, "shl")))
+    return false;
+  Opd *y = &l->op[1];
+  if (is_reg(y, 0) || (y->kind == OPD_MEM && (y->addr & BIT(0)))) return false;
+
+  int k = next(j);
+  if (k < 0) return false;
+  Line *back = &lines[k];
+  if (!is(back, "mov") || !same(&back->op[0], x) || !is_reg(&back->op[1], 0) ||
+      !reg_dead(next(k), 0))
+    return false;
+
+  mov->deleted = true;
+  l->deleted = true;
+  set_line(back, "%.*s %.*s, %.*s", l->mnlen, l->mn, x->len, x->s, y->len, y->s);
+  return true;
+}
+
+// mov A, A や mov A, B; mov B, A の2つ目を消す
+static bool redundant_mov(int i, int j) {
+  Line *a = &lines[i];
+  Line *b = &lines[j];
+  if (is(a, "mov") && is_reg64(&a->op[0]) && same(&a->op[0], &a->op[1])) {
+    a->deleted = true;
+    return true;
+  }
+  if (is(a, "mov") && is(b, "mov") && is_reg64(&a->op[0]) &&
+      is_reg64(&a->op[1]) && same(&a->op[0], &b->op[1]) &&
+      same(&a->op[1], &b->op[0])) {
+    b->deleted = true;
+    return true;
+  }
+  return false;
+}
+
+static bool apply(int i) {
+  Line *l = &lines[i];
+  if (!l->insn) return false;
+  if (fold_lea(i) || fold_imm(i)) return true;
+
+  int j = next(i);
+  if (j < 0 || !lines[j].insn) return false;
+  return push_pop(i, j) || push_insn_pop(i, j) || push_discard(i, j) ||
+         fold_rax(i, j) || redundant_mov(i, j);
+}
+
+// buf内の関数1つ分のアセンブリを最適化する
+void peephole(Buf *buf) {
+  nlines = 0;
+  for (size_t i = 0; i < buf->len; i++) nlines += buf->data[i] == '\n';
+  lines = calloc(nlines, sizeof(Line));
+
+  char *p = buf->data;
+  for (int i = 0; i < nlines; i++) {
+    char *eol = memchr(p, '\n', buf->data + buf->len - p);
+    Line *l = &lines[i];
+    l->s = p;
+    l->len = eol - p;
+
+    // 命令の行はインデントされている。ラベルや疑似命令の行はそのまま残す
+    if (*p == ' ' && l->len > 2 && p[2] != '.') {
+      l->s += 2;
+      l->len -= 2;
+      l->insn = l->indented = true;
+      parse_line(l);
+    }
+    p = eol + 1;
+  }
+
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (int i = 0; i < nlines; i++)
+      if (!lines[i].deleted && apply(i)) changed = true;
+  }
+
+  Buf out = {};
+  for (int i = 0; i < nlines; i++) {
+    Line *l = &lines[i];
+    if (l->deleted) continue;
+    if (l->indented) buf_write(&out, "  ", 2);
+    buf_write(&out, l->s, l->len);
+    buf_write(&out, "\n", 1);
+  }
+
+  for (int i = 0; i < nlines; i++) free(lines[i].own);
+  free(lines);
+  free(buf->data);
+  *buf = out;
+}
@@ -0,0 +1,178 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// 生成したコードの実行回数の計測 (-finstrument)。
+// 関数の入口とループの本体の先頭(.L.begin)にカウンタを1つずつ置き、
+// 通るたびに1を足す。カウンタは翻訳単位ごとに.dataの先頭の表にまとめる。
+// 翻訳単位の関数が初めて呼ばれたときにatexitで出力の関数を登録し、
+// プログラムの終了時に表をカレントディレクトリの9cc.profに追記する。
+// 1行が1つのカウンタで、形式は次のとおり:
+//
+//   fn <関数名> <呼ばれた回数>
+//   loop <関数名> <行>:<桁> <本体を実行した回数>
+//
+// 行と桁はループのキーワードの位置。末尾呼び出しも1回の呼び出しとして数える。
+// 何回か実行したり、複数の翻訳単位をリンクしたりすると同じ名前の行が並ぶので、
+// 読む側で足し合わせる。
+// ループのカウンタのラベルには、関数の構文木を前から順にたどったときの
+// ループの番号を使う。番号は関数のトークン列と最適化のオプションだけで
+// 決まるので、キャッシュから読んだアセンブリともずれない。
+//
+
+bool opt_instrument;
+
+// 計測結果を追記するファイル。プログラムを実行したディレクトリに作る
+#define PROFILE_PATH "9cc.prof"
+
+static void collect_loops(Node *node, Node ***loops, int *nloops) {
+  for (; node; node = node->next) {
+    if (node->kind == ND_WHILE || node->kind == ND_FOR) {
+      *loops = realloc(*loops, sizeof(Node *) * (*nloops + 1));
+      (*loops)[(*nloops)++] = node;
+    }
+
+    Node **slots[MAX_NODE_SLOTS];
+    int nslots = node_slots(node, slots);
+    for (int i = 0; i < nslots; i++) collect_loops(*slots[i], loops, nloops);
+  }
+}
+
+// 関数のループを番号順に並べた配列を返す。配列は呼び出し元が解放する
+Node **function_loops(Function *fn, int *nloops) {
+  Node **loops = NULL;
+  *nloops = 0;
+  collect_loops(fn->node, &loops, nloops);
+  return loops;
+}
+
+// 入口のカウンタに1を足す。仮引数をフレームに移した後に置くので、
+// 初めての呼び出しでここから出力の関数を登録してもよい
+void emit_entry_count(void) {
+  char *funcname = gen_ctx->fn->name;
+  emit("  mov rax, offset .L.count.%s\n", funcname);
+  emit_lit("  add qword ptr [rax], 1\n");
+  emit_lit("  cmp qword ptr [rax], 1\n");
+  emit("  jne .L.counted.%s\n", funcname);
+  emit_lit("  call .L.prof_init\n");
+  emit(".L.counted.%s:\n", funcname);
+}
+
+// 生成中の関数でのループの番号
+int loop_id(Node *loop) {
+  for (int i = 0; i < gen_ctx->nloops; i++)
+    if (gen_ctx->loops[i] == loop) return i;
+  error("internal error: loop not found");
+}
+
+// ループの本体の先頭でカウンタに1を足す。raxしか使わない
+void emit_loop_count(int id) {
+  emit("  mov rax, offset .L.count.%s.%d\n", gen_ctx->fn->name, id);
+  emit_lit("  add qword ptr [rax], 1\n");
+}
+
+// カウンタの表とそれぞれの名前を出力する。.dataの中で呼ぶ
+void emit_profile_data(Program *prog) {
+  emit_lit(".L.prof_on:\n");
+  emit_lit("  .zero 8\n");
+
+  emit_lit(".L.prof_counts:\n");
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    emit(".L.count.%s:\n", fn->name);
+    emit_lit("  .zero 8\n");
+
+    int nloops;
+    Node **loops = function_loops(fn, &nloops);
+    for (int i = 0; i < nloops; i++) {
+      emit(".L.count.%s.%d:\n", fn->name, i);
+      emit_lit("  .zero 8\n");
+    }
+    free(loops);
+  }
+
+  // 名前はカウンタと同じ順に並べた文字列
+  emit_lit(".L.prof_names:\n");
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    emit("  .string \"fn %s\"\n", fn->name);
+
+    int nloops;
+    Node **loops = function_loops(fn, &nloops);
+    for (int i = 0; i < nloops; i++) {
+      int line, col;
+      line_col(loops[i]->tok->offset, &line, &col);
+      emit("  .string \"loop %s %d:%d\"\n", fn->name, line, col);
+    }
+    free(loops);
+  }
+
+  emit_lit(".L.prof_path:\n");
+  emit_lit("  .string \"" PROFILE_PATH "\"\n");
+  emit_lit(".L.prof_mode:\n");
+  emit_lit("  .string \"a\"\n");
+  emit_lit(".L.prof_fmt:\n");
+  emit_lit("  .string \"%s %ld\\n\"\n");
+}
+
+// 出力の関数を一度だけ登録する関数と、表を書き出す関数を出力する。.textの中で呼ぶ
+void emit_profile_text(Program *prog) {
+  int ncounts = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    int nloops;
+    free(function_loops(fn, &nloops));
+    ncounts += 1 + nloops;
+  }
+
+  // 関数の入口から呼ばれるので、RSPは8バイトずれている
+  emit_lit(".L.prof_init:\n");
+  emit_lit("  mov rax, offset .L.prof_on\n");
+  emit_lit("  cmp qword ptr [rax], 0\n");
+  emit_lit("  jne .L.prof_init_done\n");
+  emit_lit("  mov qword ptr [rax], 1\n");
+  emit_lit("  sub rsp, 8\n");
+  emit_lit("  mov rdi, offset .L.prof_dump\n");
+  emit_lit("  call atexit\n");
+  emit_lit("  add rsp, 8\n");
+  emit_lit(".L.prof_init_done:\n");
+  emit_lit("  ret\n");
+
+  // rbxはカウンタ、r12は名前、r13はFILE *、r14は残りの行数
+  emit_lit(".L.prof_dump:\n");
+  emit_lit("  push rbp\n");
+  emit_lit("  mov rbp, rsp\n");
+  emit_lit("  push rbx\n");
+  emit_lit("  push r12\n");
+  emit_lit("  push r13\n");
+  emit_lit("  push r14\n");
+  emit_lit("  mov rdi, offset .L.prof_path\n");
+  emit_lit("  mov rsi, offset .L.prof_mode\n");
+  emit_lit("  call fopen\n");
+  emit_lit("  cmp rax, 0\n");
+  emit_lit("  je .L.prof_dump_done\n");
+  emit_lit("  mov r13, rax\n");
+  emit_lit("  mov rbx, offset .L.prof_counts\n");
+  emit_lit("  mov r12, offset .L.prof_names\n");
+  emit("  mov r14, %d\n", ncounts);
+  emit_lit(".L.prof_dump_loop:\n");
+  emit_lit("  mov rdi, r13\n");
+  emit_lit("  mov rsi, offset .L.prof_fmt\n");
+  emit_lit("  mov rdx, r12\n");
+  emit_lit("  mov rcx, [rbx]\n");
+  emit_lit("  mov rax, 0\n");
+  emit_lit("  call fprintf\n");
+  emit_lit("  mov rdi, r12\n");
+  emit_lit("  call strlen\n");
+  emit_lit("  add r12, rax\n");
+  emit_lit("  add r12, 1\n");
+  emit_lit("  add rbx, 8\n");
+  emit_lit("  sub r14, 1\n");
+  emit_lit("  jne .L.prof_dump_loop\n");
+  emit_lit("  mov rdi, r13\n");
+  emit_lit("  call fclose\n");
+  emit_lit(".L.prof_dump_done:\n");
+  emit_lit("  pop r14\n");
+  emit_lit("  pop r13\n");
+  emit_lit("  pop r12\n");
+  emit_lit("  pop rbx\n");
+  emit_lit("  pop rbp\n");
+  emit_lit("  ret\n");
+}
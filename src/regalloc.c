@@ -0,0 +1,106 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// 線形走査(linear scan)によるレジスタ割り当て。
+// IRは構文木から生成されるので、仮想レジスタは一度だけ定義され、
+// 生存区間は「最初に定義された命令」から「最後に使われた命令」までになる。
+//
+
+// 割り当てに使う物理レジスタ。
+// rax, rdi, rdx は命令の出力用に、rsi, rcx, r8, r9 は引数渡し用に空けておく。
+char *regs[] = {"r10", "r11", "rbx", "r12", "r13", "r14", "r15"};
+#define NUM_REGS (sizeof(regs) / sizeof(*regs))
+
+// 関数呼び出しをまたいでも値が壊れないレジスタか
+bool is_callee_saved(int r) { return r >= 2; }
+
+void alloc_regs(IRFunc *f) {
+  int n = f->nvreg + 1;
+  int *start = calloc(n, sizeof(int));
+  int *end = calloc(n, sizeof(int));
+  f->reg = calloc(n, sizeof(int));
+  f->spill = calloc(n, sizeof(int));
+
+  // 生存区間を求める
+  for (int v = 0; v < n; v++) start[v] = -1;
+
+  int *ncalls = calloc(f->len + 1, sizeof(int));  // 命令iより前のcallの数
+  for (int i = 0; i < f->len; i++) {
+    IR *ir = &f->ins[i];
+    ncalls[i + 1] = ncalls[i] + (ir->op == IR_CALL);
+
+    int uses[3 + sizeof(ir->args) / sizeof(*ir->args)];  // d, a, bとargs
+    int nuses = 0;
+    uses[nuses++] = ir->d;
+    uses[nuses++] = ir->a;
+    uses[nuses++] = ir->b;
+    for (int j = 0; j < ir->nargs; j++) uses[nuses++] = ir->args[j];
+
+    for (int j = 0; j < nuses; j++) {
+      int v = uses[j];
+      if (!v) continue;
+      if (start[v] < 0) start[v] = i;
+      end[v] = i;
+    }
+  }
+
+  // 仮想レジスタの番号は定義順なので、番号順に走査すれば開始位置順になる
+  int owner[NUM_REGS] = {};  // 物理レジスタを使用中の仮想レジスタ
+  bool used[NUM_REGS] = {};
+  int nspill = 0;
+
+  for (int v = 1; v < n; v++) {
+    f->reg[v] = -1;
+    if (start[v] < 0) continue;
+
+    // 区間が終わった仮想レジスタのレジスタを解放する
+    for (int r = 0; r < NUM_REGS; r++)
+      if (owner[r] && end[owner[r]] <= start[v]) owner[r] = 0;
+
+    // 区間の途中にcallがあれば、呼び出し先保存レジスタしか使えない
+    bool crosses_call = ncalls[end[v]] - ncalls[start[v] + 1] > 0;
+
+    int found = -1;
+    for (int r = 0; r < NUM_REGS; r++) {
+      if (owner[r] || (crosses_call && !is_callee_saved(r))) continue;
+      found = r;
+      break;
+    }
+
+    // 空きがなければ、最も遠くまで生存する区間をスピルする
+    if (found < 0) {
+      int victim = -1;
+      for (int r = 0; r < NUM_REGS; r++) {
+        if (crosses_call && !is_callee_saved(r)) continue;
+        if (victim < 0 || end[owner[r]] > end[owner[victim]]) victim = r;
+      }
+
+      if (victim >= 0 && end[owner[victim]] > end[v]) {
+        f->reg[owner[victim]] = -1;
+        f->spill[owner[victim]] = ++nspill;
+        found = victim;
+      } else {
+        f->spill[v] = ++nspill;
+        continue;
+      }
+    }
+
+    owner[found] = v;
+    used[found] = true;
+    f->reg[v] = found;
+  }
+
+  // フレームはローカル変数、退避したレジスタ、スピル領域の順に並べる
+  for (int r = 0; r < NUM_REGS; r++)
+    if (used[r] && is_callee_saved(r)) f->callee_saved[f->nsaved++] = r;
+
+  int base = f->fn->stack_size + f->nsaved * 8;
+  for (int v = 1; v < n; v++)
+    if (f->reg[v] < 0 && f->spill[v]) f->spill[v] = base + f->spill[v] * 8;
+  f->frame_size = align_to(base + nspill * 8, 16);
+
+  free(start);
+  free(end);
+  free(ncalls);
+}
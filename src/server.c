@@ -0,0 +1,239 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// コンパイルサーバ (--server <socket>)。
+// Unixドメインソケットで待ち受け、要求ごとに1つの翻訳単位をコンパイルして
+// 出力を返す。プロセスの起動を省けるほか、識別子の表、翻訳単位のアリーナや
+// 配列、関数ごとのアセンブリのキャッシュを要求の間で使い回せる。
+// 要求は届いた順に1つずつ処理する。
+//
+// 要求: クライアントの作業ディレクトリとコマンドライン引数をNUL終端の文字列で
+//       並べ、空の文字列で終える。入力ファイルが"-"なら、残りがソースになる。
+//       クライアントは書き終えたら送信側を閉じる。
+// 応答: Reply、出力先のパス、出力(アセンブリかオブジェクトファイル)、
+//       診断メッセージ(要求の処理中に標準エラー出力に出たもの)の順に並べる。
+//
+// --connect <socket> はこのプロトコルのクライアントで、引数をそのまま送り、
+// 返ってきた出力と診断メッセージを書き出す。
+//
+
+typedef struct {
+  int status;  // 終了ステータス
+  int path_len;
+  long out_len;
+  long err_len;
+} Reply;
+
+static void socket_addr(struct sockaddr_un *addr, char *path) {
+  *addr = (struct sockaddr_un){.sun_family = AF_UNIX};
+  if (strlen(path) >= sizeof(addr->sun_path))
+    error("socket path too long: %s", path);
+  strcpy(addr->sun_path, path);
+}
+
+// 相手が送信側を閉じるまでbufの後ろに読み込む。
+// 末尾には"\n\0"を付け足せるよう2バイト残しておく
+static bool recv_all(int fd, Buf *buf) {
+  for (;;) {
+    if (buf->cap - buf->len < 4096) {
+      buf->cap = buf->cap ? buf->cap * 2 : 64 * 1024;
+      buf->data = realloc(buf->data, buf->cap);
+    }
+
+    ssize_t n = read(fd, buf->data + buf->len, buf->cap - buf->len - 2);
+    if (n == 0) return true;
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    buf->len += n;
+  }
+}
+
+// 相手が先に切断しても終了しないよう、エラーは呼び出し元に返す
+static bool send_all(int fd, void *data, size_t len) {
+  char *p = data;
+  while (len > 0) {
+    ssize_t n = write(fd, p, len);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    p += n;
+    len -= n;
+  }
+  return true;
+}
+
+// 要求を作業ディレクトリと引数と入力に分ける。形式が正しくなければfalseを返す
+static bool parse_request(Buf *buf, Request *req) {
+  char *p = buf->data;
+  char *end = buf->data + buf->len;
+
+  char *q = memchr(p, '\0', end - p);
+  if (!q) return false;
+  req->cwd = p;
+  p = q + 1;
+
+  // argv[0]はusage()の表示に使う
+  req->argc = 1;
+  req->argv[0] = "9cc";
+  for (;;) {
+    q = memchr(p, '\0', end - p);
+    if (!q) return false;
+    if (q == p) break;
+    req->argv = realloc(req->argv, sizeof(char *) * (req->argc + 1));
+    req->argv[req->argc++] = p;
+    p = q + 1;
+  }
+  p++;
+
+  // read_fileと同じく、ソースは必ず"\n\0"で終わる
+  if (p == end || end[-1] != '\n') *end++ = '\n';
+  *end = '\0';
+  req->input = p;
+  return true;
+}
+
+// 要求を1つ処理し、応答を返す。診断メッセージは一時ファイルで受け取る
+static void serve_one(int fd, Buf *in, FILE *diag, int (*handle)(Request *)) {
+  in->len = 0;
+  Request req = {.argv = malloc(sizeof(char *))};
+  if (!recv_all(fd, in) || !parse_request(in, &req)) {
+    free(req.argv);
+    return;
+  }
+
+  int diag_fd = fileno(diag);
+  ftruncate(diag_fd, 0);
+  lseek(diag_fd, 0, SEEK_SET);
+  int saved = dup(2);
+  dup2(diag_fd, 2);
+
+  int status;
+  if (chdir(req.cwd) < 0) {
+    fprintf(stderr, "cannot change directory to %s: %s\n", req.cwd,
+            strerror(errno));
+    status = 1;
+  } else {
+    status = handle(&req);
+  }
+
+  dup2(saved, 2);
+  close(saved);
+
+  Buf err = {};
+  err.len = lseek(diag_fd, 0, SEEK_CUR);
+  err.data = malloc(err.len + 1);
+  if (pread(diag_fd, err.data, err.len, 0) != err.len) err.len = 0;
+
+  char *path = req.out_path ? req.out_path : "";
+  Buf *out = status == 0 && req.out ? req.out : &(Buf){};
+  // クライアントが先に切断していたら、応答は捨てる
+  Reply reply = {status, strlen(path), out->len, err.len};
+  if (send_all(fd, &reply, sizeof(reply)) &&
+      send_all(fd, path, reply.path_len) && send_all(fd, out->data, out->len))
+    send_all(fd, err.data, err.len);
+
+  free(err.data);
+  free(req.out_path);
+  free(req.argv);
+}
+
+// pathで待ち受けてから、バックグラウンドに回る。
+// 起動したサーバのプロセスIDを標準出力に書き出す
+void serve(char *path, int (*handle)(Request *req)) {
+  struct sockaddr_un addr;
+  socket_addr(&addr, path);
+
+  int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (sock < 0) error("socket: %s", strerror(errno));
+  unlink(path);  // 前のサーバが残したソケット
+  if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+      listen(sock, 64) < 0)
+    error("cannot listen on %s: %s", path, strerror(errno));
+
+  // 待ち受けを始めてから戻るので、呼び出し元はすぐに接続してよい
+  pid_t pid = fork();
+  if (pid < 0) error("fork: %s", strerror(errno));
+  if (pid > 0) {
+    printf("%d\n", pid);
+    exit(0);
+  }
+  setsid();
+  int null = open("/dev/null", O_RDWR);
+  dup2(null, 0);
+  dup2(null, 1);
+  close(null);
+
+  signal(SIGPIPE, SIG_IGN);
+  FILE *diag = tmpfile();
+  if (!diag) error("cannot create temporary file: %s", strerror(errno));
+
+  Buf in = {};
+  for (;;) {
+    int fd = accept(sock, NULL, NULL);
+    if (fd < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) continue;
+      error("accept: %s", strerror(errno));
+    }
+    serve_one(fd, &in, diag, handle);
+    close(fd);
+  }
+}
+
+// クライアント。argvを要求としてサーバに送り、応答の出力を書き出す。
+// 終了ステータスを返す
+int connect_server(char *path, int argc, char **argv) {
+  struct sockaddr_un addr;
+  socket_addr(&addr, path);
+
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) error("socket: %s", strerror(errno));
+  if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+    error("cannot connect to %s: %s", path, strerror(errno));
+
+  char cwd[PATH_MAX];
+  if (!getcwd(cwd, sizeof(cwd))) error("getcwd: %s", strerror(errno));
+
+  Buf req = {};
+  buf_write(&req, cwd, strlen(cwd) + 1);
+  bool from_stdin = false;
+  for (int i = 0; i < argc; i++) {
+    buf_write(&req, argv[i], strlen(argv[i]) + 1);
+    if (!strcmp(argv[i], "-") && (i == 0 || strcmp(argv[i - 1], "-o")))
+      from_stdin = true;
+  }
+  buf_write(&req, "", 1);
+  if (from_stdin && !recv_all(0, &req))
+    error("-: read failed: %s", strerror(errno));
+
+  Buf res = {};
+  if (!send_all(fd, req.data, req.len) || shutdown(fd, SHUT_WR) < 0 ||
+      !recv_all(fd, &res))
+    error("%s: %s", path, strerror(errno));
+  close(fd);
+
+  Reply reply;
+  if (res.len < sizeof(reply)) error("%s: broken reply", path);
+  memcpy(&reply, res.data, sizeof(reply));
+  if (res.len != sizeof(reply) + reply.path_len + reply.out_len + reply.err_len)
+    error("%s: broken reply", path);
+
+  char *p = res.data + sizeof(reply);
+  char *out_path = strndup(p, reply.path_len);
+  char *out = p + reply.path_len;
+  char *err = out + reply.out_len;
+  send_all(2, err, reply.err_len);
+  if (reply.status) return reply.status;
+
+  int out_fd = 1;
+  if (strcmp(out_path, "-")) {
+    out_fd = open(out_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (out_fd < 0)
+      error("cannot open output file %s: %s", out_path, strerror(errno));
+  }
+  if (!send_all(out_fd, out, reply.out_len))
+    error("%s: write failed: %s", out_path, strerror(errno));
+  if (out_fd != 1) close(out_fd);
+  return 0;
+}
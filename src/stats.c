@@ -0,0 +1,268 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// コンパイル時間の計測とカウンタ (--stats, --time-report)。
+// フェーズごとに経過時間とCPU時間、終了時点の最大RSSを記録し、
+// トークン、ノード、型、変数の探索、インライン展開の判断、キャッシュの
+// ヒット数、出力した命令の数と合わせて、人が読む形式かJSONで出力する。
+// 計測結果は翻訳単位(tu->stats)ごとに持つ。
+//
+
+bool collect_stats;
+
+// 複数のファイルを別々のスレッドでコンパイルするときは、CPU時間をスレッドごとに測る
+static clockid_t cpu_clock = CLOCK_PROCESS_CPUTIME_ID;
+
+static char *phase_names[] = {
+    [PH_READ] = "read",     [PH_TOKENIZE] = "tokenize",
+    [PH_PARSE] = "parse",   [PH_OPTIMIZE] = "optimize",
+    [PH_LAYOUT] = "layout", [PH_CODEGEN] = "codegen",
+};
+
+static char *node_names[] = {
+    [ND_ADD] = "ND_ADD",
+    [ND_PTR_ADD] = "ND_PTR_ADD",
+    [ND_SUB] = "ND_SUB",
+    [ND_PTR_SUB] = "ND_PTR_SUB",
+    [ND_PTR_DIFF] = "ND_PTR_DIFF",
+    [ND_MUL] = "ND_MUL",
+    [ND_DIV] = "ND_DIV",
+    [ND_SHL] = "ND_SHL",
+    [ND_NEG] = "ND_NEG",
+    [ND_EQ] = "ND_EQ",
+    [ND_NE] = "ND_NE",
+    [ND_LT] = "ND_LT",
+    [ND_LE] = "ND_LE",
+    [ND_ASSIGN] = "ND_ASSIGN",
+    [ND_MEMBER] = "ND_MEMBER",
+    [ND_ADDR] = "ND_ADDR",
+    [ND_DEREF] = "ND_DEREF",
+    [ND_RETURN] = "ND_RETURN",
+    [ND_IF] = "ND_IF",
+    [ND_WHILE] = "ND_WHILE",
+    [ND_FOR] = "ND_FOR",
+    [ND_BLOCK] = "ND_BLOCK",
+    [ND_FUNCALL] = "ND_FUNCALL",
+    [ND_EXPR_STMT] = "ND_EXPR_STMT",
+    [ND_STMT_EXPR] = "ND_STMT_EXPR",
+    [ND_VAR] = "ND_VAR",
+    [ND_NUM] = "ND_NUM",
+    [ND_NULL] = "ND_NULL",
+};
+
+static char *inline_names[] = {
+    [INL_DONE] = "inlined",
+    [INL_UNDEFINED] = "undefined",
+    [INL_NOT_LEAF] = "not a leaf",
+    [INL_TOO_LARGE] = "too large",
+    [INL_NO_RETURN] = "no return",
+    [INL_EARLY_RETURN] = "early return",
+    [INL_ARGS] = "argument count",
+};
+
+static double clock_sec(clockid_t id) {
+  struct timespec ts;
+  clock_gettime(id, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static Time now(void) {
+  return (Time){clock_sec(CLOCK_MONOTONIC), clock_sec(cpu_clock)};
+}
+
+// スレッドを作る前に呼ぶ
+void use_thread_cpu_time(void) { cpu_clock = CLOCK_THREAD_CPUTIME_ID; }
+
+// 実行中のフェーズを終え、phを開始する
+void start_phase(Phase ph) {
+  end_phase();
+  tu->stats.cur_phase = ph;
+  tu->stats.phase_start = now();
+}
+
+void end_phase(void) {
+  Stats *st = &tu->stats;
+  if (st->cur_phase < 0) return;
+  Time t = now();
+  st->phase_time[st->cur_phase].wall += t.wall - st->phase_start.wall;
+  st->phase_time[st->cur_phase].cpu += t.cpu - st->phase_start.cpu;
+
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  st->phase_rss[st->cur_phase] = ru.ru_maxrss;
+  st->cur_phase = -1;
+}
+
+// 出力するアセンブリの命令を種類ごとに数える。
+// 命令の行は空白で始まり、疑似命令の行は'.'で始まる
+void count_insns(char *s, size_t len) {
+  Stats *st = &tu->stats;
+  char *end = s + len;
+  while (s < end) {
+    char *eol = memchr(s, '\n', end - s);
+    if (!eol) eol = end;
+
+    char *p = s;
+    while (p < eol && *p == ' ') p++;
+    if (p != s && p < eol && *p != '.') {
+      char *q = p;
+      while (q < eol && *q != ' ') q++;
+
+      Symbol *sym = intern(p, q - p);
+      if (sym->id >= st->insn_cap) {
+        int cap = st->insn_cap ? st->insn_cap : 256;
+        while (cap <= sym->id) cap *= 2;
+        st->insn_counts = realloc(st->insn_counts, sizeof(long) * cap);
+        memset(st->insn_counts + st->insn_cap, 0,
+               sizeof(long) * (cap - st->insn_cap));
+        st->insn_cap = cap;
+      }
+      if (st->insn_counts[sym->id]++ == 0) {
+        st->mnemonics = realloc(st->mnemonics,
+                                sizeof(Symbol *) * (st->nmnemonics + 1));
+        st->mnemonics[st->nmnemonics++] = sym;
+      }
+    }
+    s = eol + 1;
+  }
+}
+
+// 個数の多い順に並べる
+static int cmp_mnemonic(const void *a, const void *b) {
+  long x = tu->stats.insn_counts[(*(Symbol **)a)->id];
+  long y = tu->stats.insn_counts[(*(Symbol **)b)->id];
+  if (x != y) return x < y ? 1 : -1;
+  return strcmp((*(Symbol **)a)->name, (*(Symbol **)b)->name);
+}
+
+static void print_times(FILE *out) {
+  Stats *st = &tu->stats;
+  Time total = {};
+  long rss = 0;
+  fprintf(out, "%-10s %12s %12s %12s\n", "phase", "wall(ms)", "cpu(ms)",
+          "maxrss(KB)");
+  for (int i = 0; i < NUM_PHASES; i++) {
+    fprintf(out, "%-10s %12.3f %12.3f %12ld\n", phase_names[i],
+            st->phase_time[i].wall * 1e3, st->phase_time[i].cpu * 1e3,
+            st->phase_rss[i]);
+    total.wall += st->phase_time[i].wall;
+    total.cpu += st->phase_time[i].cpu;
+    if (rss < st->phase_rss[i]) rss = st->phase_rss[i];
+  }
+  fprintf(out, "%-10s %12.3f %12.3f %12ld\n", "total", total.wall * 1e3,
+          total.cpu * 1e3, rss);
+}
+
+static void print_text(FILE *out) {
+  Stats *st = &tu->stats;
+  print_times(out);
+
+  fprintf(out, "\n%-16s %12d\n", "tokens", tu->ntokens);
+  fprintf(out, "%-16s %12ld\n", "types", type_arena.nobjs);
+  fprintf(out, "%-16s %12ld\n", "var lookups", st->var_lookups);
+  if (st->var_lookups)
+    fprintf(out, "%-16s %12.3f (max %ld)\n", "  avg probes",
+            (double)st->var_probes / st->var_lookups, st->max_var_probe);
+
+  long nnodes = 0;
+  for (int i = 0; i < NUM_NODE_KINDS; i++) nnodes += st->nodes[i];
+  fprintf(out, "%-16s %12ld\n", "nodes", nnodes);
+  for (int i = 0; i < NUM_NODE_KINDS; i++)
+    if (st->nodes[i])
+      fprintf(out, "  %-14s %12ld\n", node_names[i], st->nodes[i]);
+
+  long ncalls = 0;
+  for (int i = 0; i < NUM_INLINE_DECISIONS; i++) ncalls += st->inline_sites[i];
+  fprintf(out, "%-16s %12ld\n", "call sites", ncalls);
+  for (int i = 0; i < NUM_INLINE_DECISIONS; i++)
+    if (st->inline_sites[i])
+      fprintf(out, "  %-14s %12ld\n", inline_names[i], st->inline_sites[i]);
+
+  if (cache_enabled()) {
+    fprintf(out, "%-16s %12ld\n", "cache hits", st->cache_hits);
+    fprintf(out, "%-16s %12ld\n", "cache misses", st->cache_misses);
+  }
+
+  fprintf(out, "%-16s %12ld\n", "vector loops", st->vec_loops);
+  fprintf(out, "%-16s %12ld\n", "tail calls", st->tail_calls);
+  fprintf(out, "%-16s %12ld\n", "dead stmts", st->dead_stmts);
+  fprintf(out, "%-16s %12ld\n", "dead vars", st->dead_vars);
+
+  long ninsns = 0;
+  for (int i = 0; i < st->nmnemonics; i++)
+    ninsns += st->insn_counts[st->mnemonics[i]->id];
+  fprintf(out, "%-16s %12ld\n", "instructions", ninsns);
+  for (int i = 0; i < st->nmnemonics; i++)
+    fprintf(out, "  %-14s %12ld\n", st->mnemonics[i]->name,
+            st->insn_counts[st->mnemonics[i]->id]);
+}
+
+static void print_json(FILE *out) {
+  Stats *st = &tu->stats;
+  fprintf(out, "{\n  \"file\": \"");
+  for (char *p = tu->filename; *p; p++) {
+    if (*p == '"' || *p == '\\') fputc('\\', out);
+    fputc(*p, out);
+  }
+  fprintf(out, "\",\n  \"phases\": {");
+  for (int i = 0; i < NUM_PHASES; i++)
+    fprintf(out,
+            "%s\n    \"%s\": {\"wall_ms\": %.3f, \"cpu_ms\": %.3f, "
+            "\"maxrss_kb\": %ld}",
+            i ? "," : "", phase_names[i], st->phase_time[i].wall * 1e3,
+            st->phase_time[i].cpu * 1e3, st->phase_rss[i]);
+  fprintf(out, "\n  },\n");
+
+  fprintf(out, "  \"tokens\": %d,\n", tu->ntokens);
+  fprintf(out, "  \"types\": %ld,\n", type_arena.nobjs);
+  fprintf(out, "  \"var_lookups\": %ld,\n", st->var_lookups);
+  fprintf(out, "  \"var_probes\": %ld,\n", st->var_probes);
+  fprintf(out, "  \"max_var_probe\": %ld,\n", st->max_var_probe);
+  fprintf(out, "  \"cache_hits\": %ld,\n", st->cache_hits);
+  fprintf(out, "  \"cache_misses\": %ld,\n", st->cache_misses);
+  fprintf(out, "  \"vec_loops\": %ld,\n", st->vec_loops);
+  fprintf(out, "  \"tail_calls\": %ld,\n", st->tail_calls);
+  fprintf(out, "  \"dead_stmts\": %ld,\n", st->dead_stmts);
+  fprintf(out, "  \"dead_vars\": %ld,\n", st->dead_vars);
+
+  fprintf(out, "  \"nodes\": {");
+  bool first = true;
+  for (int i = 0; i < NUM_NODE_KINDS; i++) {
+    if (!st->nodes[i]) continue;
+    fprintf(out, "%s\n    \"%s\": %ld", first ? "" : ",", node_names[i],
+            st->nodes[i]);
+    first = false;
+  }
+  fprintf(out, "\n  },\n");
+
+  fprintf(out, "  \"inline\": {");
+  first = true;
+  for (int i = 0; i < NUM_INLINE_DECISIONS; i++) {
+    if (!st->inline_sites[i]) continue;
+    fprintf(out, "%s\n    \"%s\": %ld", first ? "" : ",", inline_names[i],
+            st->inline_sites[i]);
+    first = false;
+  }
+  fprintf(out, "\n  },\n");
+
+  fprintf(out, "  \"instructions\": {");
+  for (int i = 0; i < st->nmnemonics; i++)
+    fprintf(out, "%s\n    \"%s\": %ld", i ? "," : "", st->mnemonics[i]->name,
+            st->insn_counts[st->mnemonics[i]->id]);
+  fprintf(out, "\n  }\n}\n");
+}
+
+// 計測結果を出力する。countersが偽ならフェーズごとの時間だけを出す
+void print_stats(FILE *out, bool counters, bool json) {
+  Stats *st = &tu->stats;
+  end_phase();
+  qsort(st->mnemonics, st->nmnemonics, sizeof(Symbol *), cmp_mnemonic);
+
+  if (json)
+    print_json(out);
+  else if (counters)
+    print_text(out);
+  else
+    print_times(out);
+}
@@ -0,0 +1,100 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// 識別子の文字列を一度だけ登録(intern)し、同じ名前には同じSymbolを返す。
+// 名前の比較はポインタの比較だけで済むようになる。
+// 表はすべての翻訳単位で共有するので、登録はロックを取って行う。
+// 番号からSymbolを引くのは字句解析とパースのたびに行うので、ロックを取らない。
+//
+
+static pthread_mutex_t symbol_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static Symbol **table;  // オープンアドレス法のハッシュ表
+static int capacity;
+static int used;
+
+// 番号からSymbolを引く表。伸ばすときは新しい配列に写してから差し替え、
+// 古い配列は解放しない。ロックを取らずに読んでいるスレッドが古い配列を
+// 使っていてもよい(大きさの合計は最後の配列の2倍未満)
+static _Atomic(Symbol **) symbols;
+static int symbols_cap;
+
+// FNV-1a
+unsigned hash_bytes(char *s, int len) {
+  unsigned h = 2166136261u;
+  for (int i = 0; i < len; i++) {
+    h ^= (unsigned char)s[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static void rehash(void) {
+  int cap = capacity ? capacity * 2 : 1024;
+  Symbol **tab = calloc(cap, sizeof(Symbol *));
+
+  for (int i = 0; i < capacity; i++) {
+    Symbol *sym = table[i];
+    if (!sym) continue;
+    int j = sym->hash & (cap - 1);
+    while (tab[j]) j = (j + 1) & (cap - 1);
+    tab[j] = sym;
+  }
+
+  free(table);
+  table = tab;
+  capacity = cap;
+}
+
+// 長さlenの文字列sに対応するSymbolを返す。なければ作成する
+Symbol *intern(char *s, int len) {
+  unsigned h = hash_bytes(s, len);
+
+  pthread_mutex_lock(&symbol_lock);
+  if (used * 2 >= capacity) rehash();
+
+  int i = h & (capacity - 1);
+  for (;;) {
+    Symbol *sym = table[i];
+    if (!sym) break;
+    if (sym->hash == h && sym->len == len && !memcmp(sym->name, s, len)) {
+      pthread_mutex_unlock(&symbol_lock);
+      return sym;
+    }
+    i = (i + 1) & (capacity - 1);
+  }
+
+  Symbol *sym = arena_alloc(&symbol_arena, sizeof(Symbol));
+  sym->name = arena_strndup(&symbol_arena, s, len);
+  sym->len = len;
+  sym->hash = h;
+  sym->id = used;
+  table[i] = sym;
+
+  Symbol **syms = atomic_load_explicit(&symbols, memory_order_relaxed);
+  if (used == symbols_cap) {
+    int cap = symbols_cap ? symbols_cap * 2 : 1024;
+    Symbol **new_syms = malloc(sizeof(Symbol *) * cap);
+    if (used) memcpy(new_syms, syms, sizeof(Symbol *) * used);
+    syms = new_syms;
+    symbols_cap = cap;
+    atomic_store_explicit(&symbols, syms, memory_order_release);
+  }
+  syms[used++] = sym;
+  pthread_mutex_unlock(&symbol_lock);
+  return sym;
+}
+
+// idはintern()が返したSymbolの番号なので、その要素はもう書き込まれている
+Symbol *symbol_at(int id) {
+  return atomic_load_explicit(&symbols, memory_order_acquire)[id];
+}
+
+// 登録済みのSymbolの個数。番号は0からこの値未満になる
+int nsymbols(void) {
+  pthread_mutex_lock(&symbol_lock);
+  int n = used;
+  pthread_mutex_unlock(&symbol_lock);
+  return n;
+}
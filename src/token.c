@@ -2,11 +2,26 @@
 
 //
 // 引数として渡ってきた文字列を単語ごとに分割する
+// 状態はすべて翻訳単位(tu)が持つ
 //
 
-char *filename;
-char *user_input;  // 入力プログラム
-Token *token;      // 現在着目しているトークン
+// --keep-going: 位置のあるエラーを報告しても終了せず、解析を続けて
+// 残りのエラーも報告する。終了するかはコンパイルの最後に決める
+bool opt_keep_going;
+
+// --stream-tokens: 入力をまとめて字句解析せず、パーサが求めるたびに少しずつ
+// 読む。トークン列には、解析中のトップレベルの項目の先頭から後ろだけを置く
+bool opt_stream_tokens;
+
+// --stream-tokensで一度に読むトークンの数
+#define STREAM_BATCH 256
+
+// 致命的なエラーの後に戻る。--serverではその要求だけを打ち切り、
+// それ以外ではプロセスを終了する
+static void abort_tu(void) {
+  if (tu && tu->fatal) longjmp(*tu->fatal, 1);
+  exit(1);
+}
 
 // エラーを報告し、終了する関数
 void error(char *fmt, ...) {
@@ -14,25 +29,61 @@ void error(char *fmt, ...) {
   va_start(ap, fmt);
   vfprintf(stderr, fmt, ap);
   fprintf(stderr, "\n");
-  exit(1);
+  abort_tu();
+}
+
+// 各行の先頭の位置を表に入れる。エラーを報告するときに行番号を求めるのに使う
+static void index_lines(void) {
+  char *p = tu->user_input;
+  for (;;) {
+    if (tu->nlines == tu->lines_cap) {
+      tu->lines_cap = tu->lines_cap ? tu->lines_cap * 2 : 1024;
+      tu->lines = realloc(tu->lines, sizeof(int) * tu->lines_cap);
+    }
+    tu->lines[tu->nlines++] = p - tu->user_input;
+
+    // 入力は必ず改行で終わるので、最後の改行の後ろには行がない
+    p = strchr(p, '\n') + 1;
+    if (!*p) return;
+  }
 }
 
-// 以下の形式でエラーメッセージを報告し、終了する関数
+// 入力の位置offsetを含む行の番号(0から)を、行の先頭の表から二分探索で求める
+static int line_of(int offset) {
+  int lo = 0;
+  int hi = tu->nlines;
+  while (hi - lo > 1) {
+    int mid = (lo + hi) / 2;
+    if (tu->lines[mid] <= offset)
+      lo = mid;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+// 入力の位置offsetの行と桁(どちらも1から)を求める
+void line_col(int offset, int *line, int *col) {
+  if (!tu->nlines) index_lines();
+  int i = line_of(offset);
+  *line = i + 1;
+  *col = offset - tu->lines[i] + 1;
+}
+
+// 以下の形式でエラーメッセージを報告する関数
 static void verror_at(char *loc, char *fmt, va_list ap) {
-  // Find a line containing `loc`.
-  char *line = loc;
-  while (user_input < line && line[-1] != '\n') line--;
+  // 行の表は最初のエラーを報告するときに作る
+  if (!tu->nlines) index_lines();
 
-  char *end = loc;
-  while (*end != '\n') end++;
+  // 入力の終わりは、最後の行の末尾(入力は必ず改行で終わる)として表示する
+  if (!*loc) loc--;
 
-  // Get a line number.
-  int line_num = 1;
-  for (char *p = user_input; p < line; p++)
-    if (*p == '\n') line_num++;
+  int line_num = line_of(loc - tu->user_input);
+  char *line = tu->user_input + tu->lines[line_num];
+  char *end = strchr(loc, '\n');
 
   // Print out the line.
-  int indent = fprintf(stderr, "%s:%d: ", filename, line_num);
+  int indent = fprintf(stderr, "%s:%d: ", tu->filename, line_num + 1);
   fprintf(stderr, "%.*s\n", (int)(end - line), line);
 
   // Show the error message.
@@ -41,7 +92,13 @@ static void verror_at(char *loc, char *fmt, va_list ap) {
   fprintf(stderr, "^ ");
   vfprintf(stderr, fmt, ap);
   fprintf(stderr, "\n");
-  exit(1);
+  tu->nerrors++;
+}
+
+// エラーを報告した後に解析を中断する。--keep-goingなら最も内側の回復点に戻る
+static void fail(void) {
+  if (!opt_keep_going || !tu->recover) abort_tu();
+  longjmp(*tu->recover, 1);
 }
 
 // エラー箇所を報告し、終了する関数
@@ -49,13 +106,51 @@ void error_at(char *loc, char *fmt, ...) {
   va_list ap;
   va_start(ap, fmt);
   verror_at(loc, fmt, ap);
+  va_end(ap);
+  fail();
 }
 
 // Reports an error location and exit.
 void error_tok(Token *tok, char *fmt, ...) {
   va_list ap;
   va_start(ap, fmt);
-  verror_at(tok->str, fmt, ap);
+  verror_at(token_loc(tok), fmt, ap);
+  va_end(ap);
+  fail();
+}
+
+// エラー箇所を報告する。--keep-goingなら呼び出し元に戻る
+static void report_at(char *loc, char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  verror_at(loc, fmt, ap);
+  va_end(ap);
+  if (!opt_keep_going) abort_tu();
+}
+
+static void lex(int count);
+
+// トークン列にはtok_base番目から後ろのトークンがある
+Token *current_token(void) {
+  if (tu->tok_pos == tu->ntokens) lex(STREAM_BATCH);
+  return &tu->tokens[tu->tok_pos - tu->tok_base];
+}
+
+char *token_loc(Token *tok) { return tu->user_input + tok->offset; }
+
+long token_val(Token *tok) { return tu->num_tab[tok->aux]; }
+
+Symbol *token_sym(Token *tok) { return symbol_at(tok->aux); }
+
+char *token_contents(Token *tok) { return tu->str_tab[tok->aux].contents; }
+
+int token_cont_len(Token *tok) { return tu->str_tab[tok->aux].len; }
+
+// トークンが区切り文字またはキーワード`op`か
+static bool equal(Token *tok, char *op) {
+  char *s = token_loc(tok);
+  return tok->kind == TK_RESERVED && s[0] == op[0] && strlen(op) == tok->len &&
+         !memcmp(s, op, tok->len);
 }
 
 /*
@@ -64,20 +159,16 @@ void error_tok(Token *tok, char *fmt, ...) {
   @param op operator(演算子)
  */
 Token *consume(char *op) {
-  if (token->kind != TK_RESERVED || strlen(op) != token->len ||
-      strncmp(token->str, op, token->len))
-    return NULL;
-  Token *t = token;
-  token = token->next;
-  return t;
+  Token *tok = current_token();
+  if (!equal(tok, op)) return NULL;
+  tu->tok_pos++;
+  return tok;
 }
 
 // 現在のトークンが与えられた文字列にマッチした場合、trueを返します。
 Token *peek(char *s) {
-  if (token->kind != TK_RESERVED || strlen(s) != token->len ||
-      strncmp(token->str, s, token->len))
-    return NULL;
-  return token;
+  Token *tok = current_token();
+  return equal(tok, s) ? tok : NULL;
 }
 
 /*
@@ -86,82 +177,141 @@ Token *peek(char *s) {
   それ以外はnull
  */
 Token *consume_ident(void) {
-  if (token->kind != TK_IDENT) return NULL;
-  Token *t = token;
-  token = token->next;
-  return t;
+  Token *tok = current_token();
+  if (tok->kind != TK_IDENT) return NULL;
+  tu->tok_pos++;
+  return tok;
 }
 
 //  現在のトークンが与えられた文字列であることを確認し、トークンを1つ読み進める。
 // それ以外の場合にはエラーを報告する。
 void expect(char *s) {
-  if (!peek(s)) error_tok(token, "expected \"%s\"", s);
-  token = token->next;
+  if (!peek(s)) error_tok(current_token(), "expected \"%s\"", s);
+  tu->tok_pos++;
 }
 
 // 現在のトークンの型が数値(TK_NUM)の場合、トークンを1つ読み進めてその数値を返す。
 // それ以外の場合にはエラーを報告する。
 long expect_number(void) {
-  if (token->kind != TK_NUM) error_tok(token, "数ではありません");
-  long val = token->val;
-  token = token->next;
-  return val;
+  Token *tok = current_token();
+  if (tok->kind != TK_NUM) error_tok(tok, "数ではありません");
+  tu->tok_pos++;
+  return token_val(tok);
 }
 
-// 現在のトークンの型が識別子(TK_IDENT)の場合、トークンを1つ読み進めてその文字列を返す。
+// 現在のトークンの型が識別子(TK_IDENT)の場合、トークンを1つ読み進めてその識別子を返す。
 // それ以外の場合にはエラーを報告する。
-char *expect_ident(void) {
-  if (token->kind != TK_IDENT) error_tok(token, "識別子ではありません");
-  char *s = strndup(token->str, token->len);
-  token = token->next;
-  return s;
+Symbol *expect_ident(void) {
+  Token *tok = current_token();
+  if (tok->kind != TK_IDENT) error_tok(tok, "識別子ではありません");
+  tu->tok_pos++;
+  return token_sym(tok);
 }
 
 // 現在解析中の文字列が`;`のトークン型か？
-bool at_eof() { return token->kind == TK_EOF; }
+bool at_eof() { return current_token()->kind == TK_EOF; }
+
+// 新しいトークンをトークン列の末尾に追加する
+static Token *new_token(TokenKind kind, char *str, int len) {
+  int n = tu->ntokens - tu->tok_base;
+  if (n == tu->tokens_cap) {
+    tu->tokens_cap = tu->tokens_cap ? tu->tokens_cap * 2 : 4096;
+    if (opt_stream_tokens && tu->tokens) {
+      // 解析中の項目のノードは前の領域のトークンを指しているので、
+      // release_tokensまで前の領域も残しておく
+      Token *tokens = malloc(sizeof(Token) * tu->tokens_cap);
+      memcpy(tokens, tu->tokens, sizeof(Token) * n);
+      tu->old_tokens[tu->nold_tokens++] = tu->tokens;
+      tu->tokens = tokens;
+    } else {
+      tu->tokens = realloc(tu->tokens, sizeof(Token) * tu->tokens_cap);
+    }
+  }
 
-// 新しいトークンを作成してcurに繋げる
-static Token *new_token(TokenKind kind, Token *cur, char *str, int len) {
-  Token *tok = calloc(1, sizeof(Token));
+  Token *tok = &tu->tokens[n];
+  tu->ntokens++;
   tok->kind = kind;
-  tok->str = str;
+  tok->offset = str - tu->user_input;
   tok->len = len;
-  cur->next = tok;
+  tok->aux = 0;
   return tok;
 }
 
-/*
-  pとqが一致するか、qの文字数分の文字を比較する関数
-  @param *p トークンとして渡ってきた文字
-  @param *q 比較演算子
- */
-bool startswith(char *p, char *q) { return strncmp(p, q, strlen(q)) == 0; }
-
-static bool is_alpha(char c) {
-  return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || c == '_';
+static int add_num(long val) {
+  if (tu->num_len == tu->num_cap) {
+    tu->num_cap = tu->num_cap ? tu->num_cap * 2 : 1024;
+    tu->num_tab = realloc(tu->num_tab, sizeof(long) * tu->num_cap);
+  }
+  tu->num_tab[tu->num_len] = val;
+  return tu->num_len++;
 }
 
-// 引数`c`は半角英字(is_alpha)、数字、アンダーバーかを判定する関数
-static bool is_alnum(char c) { return is_alpha(c) || ('0' <= c && c <= '9'); }
-
-/* *pに渡されたトークンが予約語と一致したらそれを返す関数 */
-static char *starts_with_reserved(char *p) {
-  // Keyword
-  static char *kw[] = {"return", "if",   "else",   "while", "for",
-                       "int",    "char", "sizeof", "struct"};
+static int add_str(char *contents, int len) {
+  if (tu->str_len == tu->str_cap) {
+    tu->str_cap = tu->str_cap ? tu->str_cap * 2 : 64;
+    tu->str_tab = realloc(tu->str_tab, sizeof(StrLit) * tu->str_cap);
+  }
+  tu->str_tab[tu->str_len].contents = contents;
+  tu->str_tab[tu->str_len].len = len;
+  return tu->str_len++;
+}
 
-  for (int i = 0; i < sizeof(kw) / sizeof(*kw); i++) {
-    int len = strlen(kw[i]);
-    if (startswith(p, kw[i]) && !is_alnum(p[len])) return kw[i];
+// 文字の種類。字句解析のループは先頭の1文字でこの表を引いて分岐する
+enum {
+  CC_OTHER,  // トークナイズできない文字
+  CC_SPACE,  // 空白文字
+  CC_ALPHA,  // 識別子の先頭になれる文字
+  CC_DIGIT,  // 数字
+  CC_PUNCT,  // 1文字の区切り文字
+  CC_CMP,    // 後ろに'='が付くと2文字の比較演算子になる文字 (= ! < >)
+  CC_SLASH,  // '/' (コメントの開始か区切り文字)
+  CC_QUOTE,  // '"' (文字列リテラル)
+};
+
+static unsigned char char_class[256];
+static pthread_once_t char_class_once = PTHREAD_ONCE_INIT;
+
+static void init_char_class(void) {
+  for (int c = 0; c < 256; c++) {
+    if (('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || c == '_')
+      char_class[c] = CC_ALPHA;
+    else if ('0' <= c && c <= '9')
+      char_class[c] = CC_DIGIT;
+    else if (c == ' ' || ('\t' <= c && c <= '\r'))
+      char_class[c] = CC_SPACE;
+    else if (c < 128 && ispunct(c))
+      char_class[c] = CC_PUNCT;
   }
 
-  // Multi-letter punctuator(2文字以上の区切り文字。比較演算子)
-  static char *ops[] = {"==", "!=", "<=", ">="};
+  char_class['='] = char_class['!'] = CC_CMP;
+  char_class['<'] = char_class['>'] = CC_CMP;
+  char_class['/'] = CC_SLASH;
+  char_class['"'] = CC_QUOTE;
+}
 
-  for (int i = 0; i < sizeof(ops) / sizeof(*ops); i++)
-    if (startswith(p, ops[i])) return ops[i];
+// 引数`c`は半角英字、数字、アンダーバーかを判定する関数
+static bool is_alnum(char c) {
+  int cc = char_class[(unsigned char)c];
+  return cc == CC_ALPHA || cc == CC_DIGIT;
+}
 
-  return NULL;
+// 長さlenの識別子pがキーワードかを判定する。
+// 長さで候補を絞ってから比較するので、1つの識別子につき高々3回しか比較しない
+static bool is_keyword(char *p, int len) {
+  switch (len) {
+    case 2:
+      return !memcmp(p, "if", 2);
+    case 3:
+      return !memcmp(p, "for", 3) || !memcmp(p, "int", 3);
+    case 4:
+      return !memcmp(p, "else", 4) || !memcmp(p, "char", 4);
+    case 5:
+      return !memcmp(p, "while", 5);
+    case 6:
+      return !memcmp(p, "return", 6) || !memcmp(p, "sizeof", 6) ||
+             !memcmp(p, "struct", 6);
+  }
+  return false;
 }
 
 static char get_escape_char(char c) {
@@ -189,7 +339,8 @@ static char get_escape_char(char c) {
   }
 }
 
-static Token *read_string_literal(Token *cur, char *start) {
+// 文字列リテラルを読み、その長さ(両端の'"'を含む)を返す
+static int read_string_literal(char *start) {
   char *p = start + 1;
   char buf[1024];
   int len = 0;
@@ -207,84 +358,135 @@ static Token *read_string_literal(Token *cur, char *start) {
     }
   }
 
-  Token *tok = new_token(TK_STR, cur, start, p - start + 1);
-  tok->contents = malloc(len + 1);
-  memcpy(tok->contents, buf, len);
-  tok->contents[len] = '\0';
-  tok->cont_len = len + 1;
-  return tok;
+  Token *tok = new_token(TK_STR, start, p - start + 1);
+  tok->aux = add_str(arena_strndup(&tu->token_arena, buf, len), len + 1);
+  return tok->len;
 }
 
-// `user_input` をトークン化して、新しいトークンを返す
-Token *tokenize(void) {
-  char *p = user_input;
-  Token head = {};
-  Token *cur = &head;
-
+// 入力の位置pから字句解析してトークンを1つ追加し、その次の位置を返す。
+// 入力の終わりならTK_EOFのトークンを追加してNULLを返す
+static char *lex_token(char *p) {
   while (*p) {
-    // 空白文字をスキップ
-    if (isspace(*p)) {
-      p++;
-      continue;
+    switch (char_class[(unsigned char)*p]) {
+      case CC_SPACE:  // 空白文字をスキップ
+        p++;
+        continue;
+      case CC_ALPHA: {  // 識別子。読み終えてからキーワードかを判定する
+        char *q = p++;
+        while (is_alnum(*p)) p++;
+        if (is_keyword(q, p - q))
+          new_token(TK_RESERVED, q, p - q);
+        else
+          new_token(TK_IDENT, q, p - q)->aux = intern(q, p - q)->id;
+        return p;
+      }
+      case CC_DIGIT: {  // Integer literal
+        char *q = p;
+        long val = 0;
+        while (char_class[(unsigned char)*p] == CC_DIGIT)
+          val = val * 10 + (*p++ - '0');
+        new_token(TK_NUM, q, p - q)->aux = add_num(val);
+        return p;
+      }
+      case CC_CMP:  // 比較演算子 (==, !=, <=, >=) または1文字の区切り文字
+        if (p[1] == '=') {
+          new_token(TK_RESERVED, p, 2);
+          return p + 2;
+        }
+        new_token(TK_RESERVED, p, 1);
+        return p + 1;
+      case CC_SLASH:
+        // 行コメントをスキップ
+        if (p[1] == '/') {
+          p += 2;
+          while (*p != '\n') p++;
+          continue;
+        }
+
+        // ブロックコメントをスキップ
+        if (p[1] == '*') {
+          char *q = strstr(p + 2, "*/");
+          if (!q) error_at(p, "コメントが閉じられていません");
+          p = q + 2;  // strstrは見つかったところのアドレスを返すので再度+2
+          continue;
+        }
+
+        new_token(TK_RESERVED, p, 1);
+        return p + 1;
+      case CC_QUOTE:  // String literal
+        return p + read_string_literal(p);
+      case CC_PUNCT:  // 1文字の区切り文字の場合
+        new_token(TK_RESERVED, p, 1);
+        return p + 1;
     }
 
-    // 行コメントをスキップ
-    if (strncmp(p, "//", 2) == 0) {
-      p += 2;
-      while (*p != '\n') p++;
-      continue;
-    }
-
-    // ブロックコメントをスキップ
-    if (strncmp(p, "/*", 2) == 0) {
-      char *q = strstr(p + 2, "*/");
-      if (!q) error_at(p, "コメントが閉じられていません");
-      p = q + 2;  // strstrは見つかったところのアドレスを返すので再度+2
-      continue;
-    }
-
-    // String literal
-    if (*p == '"') {
-      cur = read_string_literal(cur, p);
-      p += cur->len;
-      continue;
-    }
+    // --keep-goingなら、その文字を読み飛ばして続ける
+    report_at(p, "トークナイズできません");
+    p++;
+  }
 
-    // 予約語または比較演算子
-    char *kw = starts_with_reserved(p);
-    if (kw) {
-      int len = strlen(kw);
-      cur = new_token(TK_RESERVED, cur, p, len);
-      p += len;
-      continue;
-    }
+  new_token(TK_EOF, p, 0);
+  return NULL;
+}
 
-    // Identifier
-    if (is_alpha(*p)) {
-      char *q = p++;
-      while (is_alnum(*p)) p++;
-      cur = new_token(TK_IDENT, cur, q, p - q);
-      continue;
+// 入力の続きからトークンを最大count個読み、トークン列に追加する。
+// --keep-goingで閉じていないコメントや文字列リテラルがあれば、そこで入力を終える
+static void lex(int count) {
+  jmp_buf jb;
+  jmp_buf *outer = tu->recover;
+  if (opt_keep_going) {
+    if (setjmp(jb)) {
+      tu->recover = outer;
+      new_token(TK_EOF, tu->user_input + strlen(tu->user_input), 0);
+      tu->lex_pos = -1;
+      return;
     }
+    tu->recover = &jb;
+  }
 
-    // 1文字の区切り文字の場合
-    if (ispunct(*p)) {
-      cur = new_token(TK_RESERVED, cur, p++, 1);
-      continue;
-    }
+  char *p = tu->user_input + tu->lex_pos;
+  while (p && count-- > 0) p = lex_token(p);
+  tu->lex_pos = p ? p - tu->user_input : -1;
+  tu->recover = outer;
+}
 
-    // Integer literal
-    if (isdigit(*p)) {
-      cur = new_token(TK_NUM, cur, p, 0);
-      char *q = p;
-      cur->val = strtol(p, &p, 10);
-      cur->len = q - p;
-      continue;
-    }
+// `user_input` をトークン化して`tokens`に格納する。
+// --stream-tokensでは何も読まず、パーサがトークンを求めたときに読む
+void tokenize(void) {
+  // 複数のファイルを同時にトークナイズしても、表は一度だけ作る
+  pthread_once(&char_class_once, init_char_class);
+  tu->tok_pos = 0;
+  tu->lex_pos = 0;
+  if (!opt_stream_tokens) lex(INT_MAX);
+}
 
-    error_at(p, "トークナイズできません");
+// --stream-tokens: tokがトークン列(伸ばす前の領域を含む)の要素なら、
+// 先頭からの位置を返す。そうでなければ-1を返す
+int token_index(Token *tok) {
+  int n = tu->ntokens - tu->tok_base;
+  if (tu->tokens <= tok && tok < tu->tokens + n) return tok - tu->tokens;
+
+  // 前の領域には、伸ばしたときまでのトークンが同じ位置に入っている。
+  // 領域は伸ばすたびに倍になるので、後の領域ほど大きい
+  for (int i = 0; i < tu->nold_tokens; i++) {
+    Token *old = tu->old_tokens[i];
+    int cap = tu->tokens_cap >> (tu->nold_tokens - i);
+    if (old <= tok && tok < old + cap) return tok - old;
   }
+  return -1;
+}
+
+void free_old_tokens(TU *t) {
+  for (int i = 0; i < t->nold_tokens; i++) free(t->old_tokens[i]);
+  t->nold_tokens = 0;
+}
 
-  new_token(TK_EOF, cur, p, 0);
-  return head.next;
+// --stream-tokens: 現在のトークンより前のトークンを捨て、トークン列を空ける。
+// パーサがそれより前に戻らなくなったところ(トップレベルの項目の間)で呼ぶ
+void release_tokens(void) {
+  free_old_tokens(tu);
+  int n = tu->ntokens - tu->tok_pos;
+  memmove(tu->tokens, tu->tokens + (tu->tok_pos - tu->tok_base),
+          sizeof(Token) * n);
+  tu->tok_base = tu->tok_pos;
 }
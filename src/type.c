@@ -1,51 +1,83 @@
 #include "9cc.h"
 
-Type *char_type = &(Type){TY_CHAR, 1};
-Type *int_type = &(Type){TY_INT, 8};
+Type *char_type = &(Type){TY_CHAR, 1, 1};
+Type *int_type = &(Type){TY_INT, 8, 8};
 
 /* 渡されたType構造体のkindがTY_INTであるか */
 bool is_integer(Type *ty) { return ty->kind == TY_CHAR || ty->kind == TY_INT; }
 
-// ポインタの構造体を作成し、返却する関数
-Type *pointer_to(Type *base) {
-  Type *ty = calloc(1, sizeof(Type));
-  ty->kind = TY_PTR;
-  ty->size = 8;
-  ty->base = base;
+// char_typeやint_typeから作る派生型は翻訳単位の間で共有するので、
+// 型を作るときと派生型の表を引くときはこのロックを取る
+static pthread_mutex_t type_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static Type *alloc_type(TypeKind kind, int size, int align) {
+  Type *ty = arena_alloc(&type_arena, sizeof(Type));
+  ty->kind = kind;
+  ty->size = size;
+  ty->align = align;
   return ty;
 }
 
-/* Type分のメモリを確保し、引数lenの数をty->size構造体に入れる */
-Type *array_of(Type *base, int len) {
-  Type *ty = calloc(1, sizeof(Type));
-  ty->kind = TY_ARRAY;
-  ty->size = base->size * len;
-  ty->base = base;
-  ty->array_len = len;
+Type *new_type(TypeKind kind, int size, int align) {
+  pthread_mutex_lock(&type_lock);
+  Type *ty = alloc_type(kind, size, align);
+  pthread_mutex_unlock(&type_lock);
   return ty;
 }
 
-/* 渡されたノードに型ノードを追加する関数 */
-void add_type(Node *node) {
-  if (!node || node->ty) return;
+// baseへのポインタ型を返す。一度作った型はbaseに覚えておいて使い回す
+Type *pointer_to(Type *base) {
+  pthread_mutex_lock(&type_lock);
+  Type *ty = base->ptr_to;
+  if (!ty) {
+    ty = alloc_type(TY_PTR, 8, 8);
+    ty->base = base;
+    base->ptr_to = ty;
+  }
+  pthread_mutex_unlock(&type_lock);
+  return ty;
+}
 
-  add_type(node->lhs);
-  add_type(node->rhs);
-  add_type(node->cond);
-  add_type(node->then);
-  add_type(node->els);
-  add_type(node->init);
-  add_type(node->inc);
+/* 要素がbaseで要素数がlenの配列型を返す。pointer_toと同じく使い回す */
+Type *array_of(Type *base, int len) {
+  pthread_mutex_lock(&type_lock);
+  Type *ty = base->arrays;
+  while (ty && ty->array_len != len) ty = ty->next_array;
+  if (!ty) {
+    ty = alloc_type(TY_ARRAY, base->size * len, base->align);
+    ty->base = base;
+    ty->array_len = len;
+    ty->next_array = base->arrays;
+    base->arrays = ty;
+  }
+  pthread_mutex_unlock(&type_lock);
+  return ty;
+}
 
-  for (Node *n = node->body; n; n = n->next) add_type(n);
-  for (Node *n = node->args; n; n = n->next) add_type(n);
+// 作った型をすべて捨てる(--serverで要求の間に呼ぶ)。
+// アリーナの外にあって要求の間で残る型はchar_typeとint_typeだけなので、
+// それらに覚えた派生型を忘れればよい
+void reset_types(void) {
+  pthread_mutex_lock(&type_lock);
+  char_type->ptr_to = int_type->ptr_to = NULL;
+  char_type->arrays = int_type->arrays = NULL;
+  arena_reset(&type_arena);
+  pthread_mutex_unlock(&type_lock);
+}
 
+/* ノードの型を子の型から決める関数。
+   パーサはノードを作るたびに呼ぶので、子にはすでに型が付いている。
+   木をたどり直さないので、式の深さによらずスタックを使わない。
+   文のノードには型を付けない */
+void add_type(Node *node) {
   switch (node->kind) {
     case ND_ADD:
     case ND_SUB:
     case ND_PTR_DIFF:
     case ND_MUL:
     case ND_DIV:
+    case ND_SHL:
+    case ND_NEG:
     case ND_EQ:
     case ND_NE:
     case ND_LT:
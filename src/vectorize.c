@@ -0,0 +1,202 @@
+#include "./9cc.h"
+
+//
+// 注釈：
+// 単純な配列のループの自動ベクトル化(-O1)。
+//   for (i = 初期値; i < n; i = i + 1) a[i] = b[i] + c[i];
+//   for (i = 初期値; i < n; i = i + 1) s = s + a[i];
+// の形のループを見つけ、SSE2(-mavx2ならAVX2)の命令で複数の要素をまとめて処理する。
+// 1本のベクトルレジスタにはintなら2要素(AVX2では4要素)、charなら16要素(32要素)入る。
+// 端数の要素は、後ろに続く元のループ(スカラーのエピローグ)がそのまま処理する。
+//
+// 要素ごとの式に使えるのは配列の要素の足し算と引き算だけで、配列の要素の型は
+// すべて同じでなければならない(charの計算は下位8ビットだけを求めれば足りる)。
+// 代入先のある式では、配列はポインタではなく変数として参照するので、異なる配列の
+// 領域は重ならない。添字はすべて帰納変数そのものなので、同じ配列を読み書きしても
+// 同じ要素に限られ、繰り返しの間に依存はない。
+// リダクションはintの足し算だけを扱い、ベクトルで部分和を求めてから最後に合計する。
+// メモリに書き込まないので、ポインタの指す先を読んでもよい。
+//
+
+bool opt_vectorize;  // -fvectorize/-fno-vectorize。-O1以上でしか効かない
+bool opt_avx2;       // -mavx2: 256ビットのAVX2命令を使う
+
+// 要素ごとの式に使えるベクトルレジスタ。xmm0はリダクションの部分和に使う
+#define MAX_VEC_DEPTH 15
+
+static bool is_var(Node *node, Var *var) {
+  return node->kind == ND_VAR && node->var == var;
+}
+
+// a[i]の形なら配列の変数を返す。ptr_okならポインタの変数でもよい
+static Var *elem_of(Node *node, Var *iv, bool ptr_ok) {
+  if (node->kind != ND_DEREF) return NULL;
+  Node *add = node->lhs;
+  if (add->kind != ND_PTR_ADD || add->lhs->kind != ND_VAR ||
+      !is_var(add->rhs, iv))
+    return NULL;
+
+  TypeKind kind = add->lhs->ty->kind;
+  if (kind != TY_ARRAY && !(ptr_ok && kind == TY_PTR)) return NULL;
+  return add->lhs->var;
+}
+
+static bool add_array(VecLoop *vl, Var *var) {
+  if (var->ty->base != vl->elem) return false;
+  for (int i = 0; i < vl->narrays; i++)
+    if (vl->arrays[i] == var) return true;
+  if (vl->narrays == MAX_VEC_ARRAYS) return false;
+  vl->arrays[vl->narrays++] = var;
+  return true;
+}
+
+// 要素ごとの式なら、計算に使うベクトルレジスタの数を返す。そうでなければ0
+static int vec_expr(VecLoop *vl, Node *node, Var *iv) {
+  Var *var = elem_of(node, iv, !vl->dest);
+  if (var) return add_array(vl, var);
+
+  if (node->kind != ND_ADD && node->kind != ND_SUB) return 0;
+  int l = vec_expr(vl, node->lhs, iv);
+  int r = vec_expr(vl, node->rhs, iv);
+  if (!l || !r) return 0;
+  return l > r ? l : r + 1;
+}
+
+// ループがベクトル化できる形ならvlに内容を入れてtrueを返す
+bool match_vec_loop(Node *node, Var *iv, VecLoop *vl) {
+  *vl = (VecLoop){};
+  if (node->kind != ND_FOR || !node->cond || !node->inc) return false;
+
+  // i < n (nはループの中で変わらない)
+  Node *cond = node->cond;
+  if (cond->kind != ND_LT || !is_var(cond->lhs, iv)) return false;
+  Node *bound = cond->rhs;
+  if (bound->kind != ND_NUM &&
+      !(bound->kind == ND_VAR && bound->ty->kind == TY_INT && bound->var != iv))
+    return false;
+
+  // i = i + 1
+  Node *inc = node->inc->lhs;
+  if (inc->kind != ND_ASSIGN || !is_var(inc->lhs, iv) ||
+      inc->rhs->kind != ND_ADD || !is_var(inc->rhs->lhs, iv) ||
+      inc->rhs->rhs->kind != ND_NUM || inc->rhs->rhs->val != 1)
+    return false;
+
+  Node *body = node->then;
+  if (body->kind == ND_BLOCK && body->body && !body->body->next)
+    body = body->body;
+  if (body->kind != ND_EXPR_STMT || body->lhs->kind != ND_ASSIGN) return false;
+  Node *assign = body->lhs;
+
+  int depth = 0;
+  Var *dest = elem_of(assign->lhs, iv, false);
+  if (dest) {
+    // a[i] = 要素ごとの式
+    vl->elem = dest->ty->base;
+    if (vl->elem->kind != TY_INT && vl->elem->kind != TY_CHAR) return false;
+    vl->dest = dest;
+    vl->expr = assign->rhs;
+    add_array(vl, dest);
+    depth = vec_expr(vl, vl->expr, iv);
+  } else if (assign->lhs->kind == ND_VAR &&
+             assign->lhs->ty->kind == TY_INT && assign->lhs->var != iv) {
+    // s = s + 要素ごとの式
+    Var *sum = assign->lhs->var;
+    Node *rhs = assign->rhs;
+    if (rhs->kind != ND_ADD) return false;
+    Node *expr = is_var(rhs->lhs, sum)   ? rhs->rhs
+                 : is_var(rhs->rhs, sum) ? rhs->lhs
+                                         : NULL;
+    if (!expr || (bound->kind == ND_VAR && bound->var == sum)) return false;
+    vl->elem = int_type;
+    vl->sum = sum;
+    vl->expr = expr;
+    depth = vec_expr(vl, expr, iv);
+  }
+
+  if (!depth || depth > MAX_VEC_DEPTH) return false;
+  vl->bound = bound;
+  return true;
+}
+
+//
+// ベクトル命令の出力
+//
+
+// 1回の繰り返しで処理する要素の数
+static int lanes(VecLoop *vl) { return (opt_avx2 ? 32 : 16) / vl->elem->size; }
+
+static char *vreg_name(void) { return opt_avx2 ? "ymm" : "xmm"; }
+
+// SSE2ならop x, y、AVX2ならvop y, y, zの形の演算
+static void emit_vop(char *insn, int d, int s) {
+  if (opt_avx2)
+    emit("  v%s ymm%d, ymm%d, ymm%d\n", insn, d, d, s);
+  else
+    emit("  %s xmm%d, xmm%d\n", insn, d, s);
+}
+
+static char *base_of(VecLoop *vl, Var *var, char **bases) {
+  for (int i = 0; i < vl->narrays; i++)
+    if (vl->arrays[i] == var) return bases[i];
+  error("internal error: array not found");
+}
+
+// 要素ごとの式の値をベクトルレジスタrに求める。右辺にはr+1から使う
+static void gen_vec_expr(VecLoop *vl, Node *node, int r, char **bases) {
+  if (node->kind == ND_DEREF) {
+    emit("  %smovdqu %s%d, [%s+rax*%d]\n", opt_avx2 ? "v" : "", vreg_name(),
+         r, base_of(vl, node->lhs->lhs->var, bases), vl->elem->size);
+    return;
+  }
+
+  gen_vec_expr(vl, node->lhs, r, bases);
+  gen_vec_expr(vl, node->rhs, r + 1, bases);
+  char insn[8];
+  sprintf(insn, "%s%c", node->kind == ND_ADD ? "padd" : "psub",
+          vl->elem->size == 8 ? 'q' : 'b');
+  emit_vop(insn, r, r + 1);
+}
+
+// ベクトル化したループを出力する。raxに帰納変数、rdiに上限が入っていて、
+// basesはarraysのアドレスが入ったレジスタの名前。
+// 抜けたところでraxは残りの最初の要素の添字になり、リダクションなら
+// rdiに部分和の合計が入る
+void emit_vec_loop(VecLoop *vl, char **bases, char *funcname, int seq) {
+  int n = lanes(vl);
+  char *v = opt_avx2 ? "v" : "";
+
+  // i + n <= 上限 の間、つまり i < 上限 - (n - 1) の間繰り返す
+  emit("  sub rdi, %d\n", n - 1);
+  if (vl->sum) emit_vop("pxor", 0, 0);
+  emit_lit("  cmp rax, rdi\n");
+  emit("  jge .L.vend.%s.%d\n", funcname, seq);
+  emit(".L.vbegin.%s.%d:\n", funcname, seq);
+
+  gen_vec_expr(vl, vl->expr, 1, bases);
+  if (vl->dest)
+    emit("  %smovdqu [%s+rax*%d], %s1\n", v, base_of(vl, vl->dest, bases),
+         vl->elem->size, vreg_name());
+  else
+    emit_vop("paddq", 0, 1);
+
+  emit("  add rax, %d\n", n);
+  emit_lit("  cmp rax, rdi\n");
+  emit("  jl .L.vbegin.%s.%d\n", funcname, seq);
+  emit(".L.vend.%s.%d:\n", funcname, seq);
+
+  // 部分和を合計する。AVX2では上位128ビットを下位に足してからSSE2の命令に戻る
+  if (vl->sum && opt_avx2) {
+    emit_lit("  vextracti128 xmm1, ymm0, 1\n");
+    emit_lit("  vpaddq xmm0, xmm0, xmm1\n");
+  }
+
+  // 上位128ビットを使った後は、SSE2の命令や呼び出し先が遅くならないよう消しておく
+  if (opt_avx2) emit_lit("  vzeroupper\n");
+
+  if (vl->sum) {
+    emit_lit("  pshufd xmm1, xmm0, 78\n");
+    emit_lit("  paddq xmm0, xmm1\n");
+    emit_lit("  movq rdi, xmm0\n");
+  }
+}